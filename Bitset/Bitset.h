@@ -0,0 +1,563 @@
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <bit>
+#include <string>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "../Static_Array/Array.h"
+#include "../Utility/Hash.h"
+
+// fixed-size sequence of bits (std::bitset) stored in an Array of 64-bit words
+//
+// Bulk operations run a word at a time, four words per AVX2 instruction where the target supports it,
+// while count() and the searches use POPCNT and TZCNT (std::popcount and std::countr_zero).
+// Bits past _Bits in the last word are kept zero, so no operation needs to mask them on read.
+// Everything is constexpr; the AVX2 paths are only taken outside constant evaluation.
+
+class _BitsetSetBitIterator;
+
+// without POPCNT std::popcount becomes a libgcc call per word, the SWAR form below stays inline
+constexpr size_t _popcount(uint64_t word) {
+#ifdef __POPCNT__
+    return std::popcount(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// bulk word operations, applied to 64-bit words and, with AVX2, to 256-bit vectors
+
+struct _BitsetAnd {
+    static constexpr uint64_t apply(uint64_t left, uint64_t right) {
+        return left & right;
+    }
+
+#ifdef __AVX2__
+    static __m256i apply(__m256i left, __m256i right) {
+        return _mm256_and_si256(left, right);
+    }
+#endif
+};
+
+struct _BitsetOr {
+    static constexpr uint64_t apply(uint64_t left, uint64_t right) {
+        return left | right;
+    }
+
+#ifdef __AVX2__
+    static __m256i apply(__m256i left, __m256i right) {
+        return _mm256_or_si256(left, right);
+    }
+#endif
+};
+
+struct _BitsetXor {
+    static constexpr uint64_t apply(uint64_t left, uint64_t right) {
+        return left ^ right;
+    }
+
+#ifdef __AVX2__
+    static __m256i apply(__m256i left, __m256i right) {
+        return _mm256_xor_si256(left, right);
+    }
+#endif
+};
+
+struct _BitsetAndNot {
+    static constexpr uint64_t apply(uint64_t left, uint64_t right) {
+        return left & ~right;
+    }
+
+#ifdef __AVX2__
+    static __m256i apply(__m256i left, __m256i right) {
+        return _mm256_andnot_si256(right, left);
+    }
+#endif
+};
+
+// range of the positions of the set bits, in increasing order
+class _BitsetSetBits {
+public:
+    constexpr _BitsetSetBits(const uint64_t* words, size_t wordCount) : _words(words), _wordCount(wordCount) {}
+
+    constexpr _BitsetSetBitIterator begin() const;
+
+    constexpr _BitsetSetBitIterator end() const;
+
+private:
+    const uint64_t* _words;
+    size_t _wordCount;
+};
+
+// interface of fixed-size Bitset
+
+template<size_t _Bits>
+class Bitset {
+public:
+    static_assert(_Bits > 0, "Bitset Error: Bitset must hold at least one bit!");
+
+    using set_bits_range = _BitsetSetBits;
+
+    // ctors
+    constexpr Bitset() = default;
+
+    // the low bits of value, as with std::bitset
+    constexpr explicit Bitset(uint64_t value);
+
+    // element access
+    constexpr bool operator[](size_t pos) const;
+
+    constexpr bool test(size_t pos) const;
+
+    constexpr bool all() const;
+
+    constexpr bool any() const;
+
+    constexpr bool none() const;
+
+    constexpr size_t count() const;
+
+    constexpr size_t size() const;
+
+    // the first set bit, or size() when there is none
+    constexpr size_t find_first() const;
+
+    // the first set bit after pos, or size() when there is none
+    constexpr size_t find_next(size_t pos) const;
+
+    // the positions of the set bits, e.g. for (size_t pos : bits.set_bits())
+    constexpr set_bits_range set_bits() const;
+
+    constexpr const uint64_t* words() const;
+
+    static constexpr size_t word_count();
+
+    // modifiers
+    constexpr Bitset& set();
+    constexpr Bitset& set(size_t pos, bool value = true);
+
+    constexpr Bitset& reset();
+    constexpr Bitset& reset(size_t pos);
+
+    constexpr Bitset& flip();
+    constexpr Bitset& flip(size_t pos);
+
+    // bulk operations
+    constexpr Bitset& operator&=(const Bitset& other);
+
+    constexpr Bitset& operator|=(const Bitset& other);
+
+    constexpr Bitset& operator^=(const Bitset& other);
+
+    // clears the bits set in other
+    constexpr Bitset& and_not(const Bitset& other);
+
+    constexpr Bitset operator~() const;
+
+    // the number of bits set in both, without materializing the intersection
+    constexpr size_t count_and(const Bitset& other) const;
+
+    constexpr bool intersects(const Bitset& other) const;
+
+    // operations
+    std::string to_string() const;
+
+    size_t hash() const;
+
+private:
+    static constexpr size_t _WordCount = (_Bits + 63) / 64;
+
+    // the valid bits of the last word
+    static constexpr uint64_t _lastWordMask = _Bits % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (_Bits % 64)) - 1;
+
+    constexpr void _checkPosition(size_t pos) const;
+
+    constexpr void _trimLastWord();
+
+    template<typename _Op>
+    constexpr void _apply(const Bitset& other);
+
+private:
+    alignas(32) Array<uint64_t, _WordCount> _words{};
+};
+
+// Bitset definition
+
+template<size_t _Bits>
+constexpr void Bitset<_Bits>::_checkPosition(size_t pos) const {
+    if (pos >= _Bits) {
+        throw std::out_of_range("Bitset Error: Index out of bounds!");
+    }
+}
+
+template<size_t _Bits>
+constexpr void Bitset<_Bits>::_trimLastWord() {
+    _words[_WordCount - 1] &= _lastWordMask;
+}
+
+template<size_t _Bits>
+template<typename _Op>
+constexpr void Bitset<_Bits>::_apply(const Bitset& other) {
+    size_t idx = 0;
+
+#ifdef __AVX2__
+    if (!std::is_constant_evaluated()) {
+        for (; idx + 4 <= _WordCount; idx += 4) {
+            const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_words.data() + idx));
+            const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other._words.data() + idx));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_words.data() + idx), _Op::apply(left, right));
+        }
+    }
+#endif
+
+    for (; idx < _WordCount; idx++) {
+        _words[idx] = _Op::apply(_words[idx], other._words[idx]);
+    }
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>::Bitset(uint64_t value) {
+    _words[0] = value;
+    _trimLastWord();
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::operator[](size_t pos) const {
+    return (_words[pos / 64] >> (pos % 64)) & 1;
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::test(size_t pos) const {
+    _checkPosition(pos);
+
+    return (*this)[pos];
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::all() const {
+    for (size_t idx = 0; idx + 1 < _WordCount; idx++) {
+        if (_words[idx] != ~uint64_t(0)) {
+            return false;
+        }
+    }
+
+    return _words[_WordCount - 1] == _lastWordMask;
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::any() const {
+    uint64_t merged = 0;
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        merged |= _words[idx];
+    }
+
+    return merged != 0;
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::none() const {
+    return !any();
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::count() const {
+    size_t bits = 0;
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        bits += _popcount(_words[idx]);
+    }
+
+    return bits;
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::size() const {
+    return _Bits;
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::find_first() const {
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        if (_words[idx] != 0) {
+            return idx * 64 + std::countr_zero(_words[idx]);
+        }
+    }
+
+    return _Bits;
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::find_next(size_t pos) const {
+    pos++;
+    if (pos >= _Bits) {
+        return _Bits;
+    }
+
+    // the rest of pos's own word first, then whole words
+    size_t idx = pos / 64;
+    const uint64_t rest = _words[idx] & (~uint64_t(0) << (pos % 64));
+    if (rest != 0) {
+        return idx * 64 + std::countr_zero(rest);
+    }
+
+    for (idx++; idx < _WordCount; idx++) {
+        if (_words[idx] != 0) {
+            return idx * 64 + std::countr_zero(_words[idx]);
+        }
+    }
+
+    return _Bits;
+}
+
+template<size_t _Bits>
+constexpr typename Bitset<_Bits>::set_bits_range Bitset<_Bits>::set_bits() const {
+    return set_bits_range(_words.data(), _WordCount);
+}
+
+template<size_t _Bits>
+constexpr const uint64_t* Bitset<_Bits>::words() const {
+    return _words.data();
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::word_count() {
+    return _WordCount;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::set() {
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        _words[idx] = ~uint64_t(0);
+    }
+    _trimLastWord();
+
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::set(size_t pos, bool value) {
+    _checkPosition(pos);
+
+    const uint64_t bit = uint64_t(1) << (pos % 64);
+    _words[pos / 64] = value ? _words[pos / 64] | bit : _words[pos / 64] & ~bit;
+
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::reset() {
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        _words[idx] = 0;
+    }
+
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::reset(size_t pos) {
+    return set(pos, false);
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::flip() {
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        _words[idx] = ~_words[idx];
+    }
+    _trimLastWord();
+
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::flip(size_t pos) {
+    _checkPosition(pos);
+
+    _words[pos / 64] ^= uint64_t(1) << (pos % 64);
+
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::operator&=(const Bitset& other) {
+    _apply<_BitsetAnd>(other);
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::operator|=(const Bitset& other) {
+    _apply<_BitsetOr>(other);
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::operator^=(const Bitset& other) {
+    _apply<_BitsetXor>(other);
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits>& Bitset<_Bits>::and_not(const Bitset& other) {
+    _apply<_BitsetAndNot>(other);
+    return *this;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits> Bitset<_Bits>::operator~() const {
+    Bitset result = *this;
+    return result.flip();
+}
+
+template<size_t _Bits>
+constexpr size_t Bitset<_Bits>::count_and(const Bitset& other) const {
+    size_t bits = 0;
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        bits += _popcount(_words[idx] & other._words[idx]);
+    }
+
+    return bits;
+}
+
+template<size_t _Bits>
+constexpr bool Bitset<_Bits>::intersects(const Bitset& other) const {
+    uint64_t merged = 0;
+    for (size_t idx = 0; idx < _WordCount; idx++) {
+        merged |= _words[idx] & other._words[idx];
+    }
+
+    return merged != 0;
+}
+
+template<size_t _Bits>
+std::string Bitset<_Bits>::to_string() const {
+    // the highest bit first, as with std::bitset
+    std::string text(_Bits, '0');
+    for (size_t pos = find_first(); pos < _Bits; pos = find_next(pos)) {
+        text[_Bits - 1 - pos] = '1';
+    }
+
+    return text;
+}
+
+template<size_t _Bits>
+size_t Bitset<_Bits>::hash() const {
+    return _words.hash();
+}
+
+// non-member operators
+
+template<size_t _Bits>
+constexpr Bitset<_Bits> operator&(const Bitset<_Bits>& left, const Bitset<_Bits>& right) {
+    Bitset<_Bits> result = left;
+    return result &= right;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits> operator|(const Bitset<_Bits>& left, const Bitset<_Bits>& right) {
+    Bitset<_Bits> result = left;
+    return result |= right;
+}
+
+template<size_t _Bits>
+constexpr Bitset<_Bits> operator^(const Bitset<_Bits>& left, const Bitset<_Bits>& right) {
+    Bitset<_Bits> result = left;
+    return result ^= right;
+}
+
+template<size_t _Bits>
+constexpr bool operator==(const Bitset<_Bits>& left, const Bitset<_Bits>& right) {
+    for (size_t idx = 0; idx < Bitset<_Bits>::word_count(); idx++) {
+        if (left.words()[idx] != right.words()[idx]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<size_t _Bits>
+struct std::hash<Bitset<_Bits>> {
+    size_t operator()(const Bitset<_Bits>& bits) const {
+        return bits.hash();
+    }
+};
+
+// definition of forward iterator over the positions of the set bits
+
+class _BitsetSetBitIterator {
+public:
+    using _Self = _BitsetSetBitIterator;
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = size_t;
+
+    // ctors
+    constexpr _BitsetSetBitIterator() : _words(nullptr), _wordCount(0), _idx(0), _current(0) {}
+
+    constexpr _BitsetSetBitIterator(const uint64_t* words, size_t wordCount, size_t idx)
+        : _words(words), _wordCount(wordCount), _idx(idx), _current(idx < wordCount ? words[idx] : 0) {
+        _skipEmptyWords();
+    }
+
+    // operator overloads
+    constexpr bool operator==(const _Self& right) const {
+        return _idx == right._idx && _current == right._current;
+    }
+
+    constexpr size_t operator*() const {
+        return _idx * 64 + std::countr_zero(_current);
+    }
+
+    // iterator increment
+    constexpr _Self& operator++() { // prefix
+        // clears the lowest set bit (BLSR)
+        _current &= _current - 1;
+        _skipEmptyWords();
+
+        return *this;
+    }
+
+    constexpr _Self operator++(int) { // postfix
+        _Self tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+private:
+    constexpr void _skipEmptyWords() {
+        while (_current == 0 && _idx < _wordCount) {
+            _idx++;
+            _current = _idx < _wordCount ? _words[_idx] : 0;
+        }
+    }
+
+private:
+    const uint64_t* _words;
+    size_t _wordCount;
+    size_t _idx; // the word being scanned, _wordCount at the end
+    uint64_t _current; // its bits not visited yet
+};
+
+constexpr _BitsetSetBitIterator _BitsetSetBits::begin() const {
+    return _BitsetSetBitIterator(_words, _wordCount, 0);
+}
+
+constexpr _BitsetSetBitIterator _BitsetSetBits::end() const {
+    return _BitsetSetBitIterator(_words, _wordCount, _wordCount);
+}
+
+#endif // !BITSET_H
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <bitset>
+
+#include "Bitset.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const char* name, double nanoseconds) {
+    std::cout << std::left << std::setw(44) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(2) << nanoseconds << " ns" << std::endl;
+}
+
+constexpr size_t ITERATION_BUDGET = size_t(1) << 26; // bits processed per measurement
+
+// fills both a Bitset and a std::bitset with the same random bits of the given density
+template<size_t _Bits>
+void fillRandom(Bitset<_Bits>& bits, std::bitset<_Bits>& reference, double density, std::mt19937_64& rng) {
+    std::bernoulli_distribution coin(density);
+    for (size_t pos = 0; pos < _Bits; pos++) {
+        const bool value = coin(rng);
+        bits.set(pos, value);
+        reference.set(pos, value);
+    }
+}
+
+template<size_t _Bits>
+void runIteration(std::mt19937_64& rng) {
+    const size_t iterations = ITERATION_BUDGET / _Bits;
+
+    for (double density : { 0.01, 0.1, 0.5 }) {
+        Bitset<_Bits> bits;
+        std::bitset<_Bits> reference;
+        fillRandom(bits, reference, density, rng);
+
+        std::cout << "Bitset<" << _Bits << ">, " << density * 100 << "% of the bits set" << std::endl;
+
+        double ns = measureNs(iterations, [&] {
+            size_t sum = 0;
+            for (size_t pos : bits.set_bits()) {
+                sum += pos;
+            }
+            doNotOptimize(sum);
+        });
+        printRow("  Bitset::set_bits()", ns);
+
+        ns = measureNs(iterations, [&] {
+            size_t sum = 0;
+            for (size_t pos = bits.find_first(); pos < bits.size(); pos = bits.find_next(pos)) {
+                sum += pos;
+            }
+            doNotOptimize(sum);
+        });
+        printRow("  Bitset::find_first/find_next", ns);
+
+        ns = measureNs(iterations, [&] {
+            size_t sum = 0;
+            for (size_t pos = 0; pos < reference.size(); pos++) {
+                if (reference[pos]) {
+                    sum += pos;
+                }
+            }
+            doNotOptimize(sum);
+        });
+        printRow("  std::bitset, test every bit", ns);
+    }
+}
+
+template<size_t _Bits>
+void runBulk(std::mt19937_64& rng) {
+    const size_t iterations = ITERATION_BUDGET / _Bits;
+
+    Bitset<_Bits> left, right;
+    std::bitset<_Bits> referenceLeft, referenceRight;
+    fillRandom(left, referenceLeft, 0.3, rng);
+    fillRandom(right, referenceRight, 0.3, rng);
+
+    std::cout << "Bitset<" << _Bits << ">" << std::endl;
+
+    double ns = measureNs(iterations, [&] {
+        doNotOptimize(left.count_and(right));
+    });
+    printRow("  Bitset::count_and", ns);
+
+    ns = measureNs(iterations, [&] {
+        doNotOptimize((left & right).count());
+    });
+    printRow("  (Bitset & Bitset).count()", ns);
+
+    ns = measureNs(iterations, [&] {
+        doNotOptimize((referenceLeft & referenceRight).count());
+    });
+    printRow("  (std::bitset & std::bitset).count()", ns);
+
+    ns = measureNs(iterations, [&] {
+        left ^= right;
+        doNotOptimize(left);
+    });
+    printRow("  Bitset ^=", ns);
+
+    ns = measureNs(iterations, [&] {
+        referenceLeft ^= referenceRight;
+        doNotOptimize(referenceLeft);
+    });
+    printRow("  std::bitset ^=", ns);
+
+    ns = measureNs(iterations, [&] {
+        left.and_not(right);
+        doNotOptimize(left);
+    });
+    printRow("  Bitset::and_not", ns);
+
+    ns = measureNs(iterations, [&] {
+        referenceLeft &= ~referenceRight;
+        doNotOptimize(referenceLeft);
+    });
+    printRow("  std::bitset &= ~", ns);
+}
+
+int main() {
+    std::mt19937_64 rng(42);
+
+#ifdef __AVX2__
+    std::cout << "(AVX2 bulk operations enabled)\n" << std::endl;
+#else
+    std::cout << "(scalar bulk operations, build with -mavx2 for the AVX2 path)\n" << std::endl;
+#endif
+
+    std::cout << "SET-BIT ITERATION, summing the positions\n" << std::endl;
+    runIteration<256>(rng);
+    runIteration<4096>(rng);
+    runIteration<65536>(rng);
+
+    std::cout << "\nINTERSECTION COUNT AND BULK OPERATIONS, 30% density\n" << std::endl;
+    runBulk<256>(rng);
+    runBulk<4096>(rng);
+    runBulk<65536>(rng);
+
+    return 0;
+}
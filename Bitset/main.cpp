@@ -0,0 +1,95 @@
+#include <iostream>
+#include <fstream>
+
+#include "Bitset.h"
+
+// compile-time permission masks
+constexpr Bitset<300> makeMask(size_t first, size_t last) {
+    Bitset<300> mask;
+    for (size_t pos = first; pos < last; pos++) {
+        mask.set(pos);
+    }
+
+    return mask;
+}
+
+constexpr Bitset<300> readPermissions = makeMask(0, 100);
+constexpr Bitset<300> writePermissions = makeMask(64, 200);
+
+static_assert((readPermissions & writePermissions).count() == 36);
+static_assert(readPermissions.count_and(writePermissions) == 36);
+static_assert(writePermissions.find_first() == 64);
+static_assert(writePermissions.find_next(199) == 300);
+static_assert((~Bitset<300>()).all() && (~Bitset<300>()).count() == 300);
+
+int main() {
+    std::ofstream myBitsetTestFile("BitsetTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myBitsetTestFile << "BITSET\n" << std::endl;
+
+    // single bits and std::bitset-like queries
+    {
+        Bitset<70> bits(0b1011);
+        bits.set(65).set(69).flip(0);
+
+        myBitsetTestFile << "Bitset<70>(0b1011).set(65).set(69).flip(0)" << std::endl;
+        myBitsetTestFile << bits.to_string() << std::endl;
+        myBitsetTestFile << "count() = " << bits.count() << ", any() = " << std::boolalpha << bits.any()
+                         << ", all() = " << bits.all() << ", test(65) = " << bits.test(65) << std::endl;
+
+        myBitsetTestFile << "set bits:";
+        for (size_t pos : bits.set_bits()) {
+            myBitsetTestFile << " " << pos;
+        }
+        myBitsetTestFile << std::endl;
+
+        myBitsetTestFile << "find_first/find_next:";
+        for (size_t pos = bits.find_first(); pos < bits.size(); pos = bits.find_next(pos)) {
+            myBitsetTestFile << " " << pos;
+        }
+        myBitsetTestFile << std::endl;
+
+        try {
+            bits.test(70);
+        } catch (const std::out_of_range& error) {
+            myBitsetTestFile << "test(70) threw: " << error.what() << std::endl;
+        }
+    }
+
+    // bulk operations over several words
+    {
+        Bitset<1024> evens, threes;
+        for (size_t pos = 0; pos < 1024; pos += 2) {
+            evens.set(pos);
+        }
+        for (size_t pos = 0; pos < 1024; pos += 3) {
+            threes.set(pos);
+        }
+
+        myBitsetTestFile << "\nBitset<1024>, multiples of 2 and of 3" << std::endl;
+        myBitsetTestFile << "(evens & threes).count() = " << (evens & threes).count()
+                         << ", count_and() = " << evens.count_and(threes) << std::endl;
+        myBitsetTestFile << "(evens | threes).count() = " << (evens | threes).count() << std::endl;
+        myBitsetTestFile << "(evens ^ threes).count() = " << (evens ^ threes).count() << std::endl;
+
+        Bitset<1024> onlyEvens = evens;
+        onlyEvens.and_not(threes);
+        myBitsetTestFile << "evens.and_not(threes).count() = " << onlyEvens.count()
+                         << ", first ones:";
+        size_t shown = 0;
+        for (size_t pos : onlyEvens.set_bits()) {
+            if (shown++ == 8) {
+                break;
+            }
+            myBitsetTestFile << " " << pos;
+        }
+        myBitsetTestFile << std::endl;
+
+        myBitsetTestFile << "evens == onlyEvens: " << (evens == onlyEvens)
+                         << ", onlyEvens.intersects(threes): " << onlyEvens.intersects(threes) << std::endl;
+    }
+
+    myBitsetTestFile.close();
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#ifndef CONCURRENTSTACK_H
+#define CONCURRENTSTACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "../Utility/CacheLine.h"
+#include "../Utility/EpochReclaimer.h"
+
+// interface of a lock-free FILO stack (Treiber stack) safe to push and pop from any number of threads.
+// The head is a tagged pointer: the low 48 bits hold the node address and the high 16 bits a counter that
+// every successful CAS increments, so a head that was popped and pushed again between a load and a CAS
+// (the ABA problem) no longer compares equal. Popped nodes are not freed immediately but retired to the
+// EpochReclaimer, which deletes them once no thread that might still read their next pointer is pinned.
+// top() cannot be offered safely, so try_pop combines reading and removing the top element.
+
+template<typename _Type>
+class ConcurrentStack {
+public:
+    using value_type = _Type;
+    using size_type = size_t;
+    using reference = _Type&;
+    using const_reference = const _Type&;
+
+public:
+    static_assert(sizeof(void*) == sizeof(uint64_t), "ConcurrentStack Error: Tagged pointers need 64-bit addresses!");
+
+    // ctors
+    ConcurrentStack();
+
+    ConcurrentStack(const ConcurrentStack& source) = delete;
+
+    // dtor, must not run concurrently with any other member
+    ~ConcurrentStack();
+
+    // operator=
+    ConcurrentStack& operator=(const ConcurrentStack& right) = delete;
+
+    // capacity
+    bool empty() const;
+
+    // modifiers
+    void push(const _Type& value);
+    void push(_Type&& value);
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // moves the top element into value and removes it; false if the stack was empty
+    bool try_pop(_Type& value);
+
+private:
+    struct _Node {
+        template<typename... Args>
+        explicit _Node(Args&&... args) : _value(std::forward<Args>(args)...) {}
+
+        _Type _value;
+        _Node* _next = nullptr;
+    };
+
+    static constexpr uint64_t _POINTER_BITS = 48;
+    static constexpr uint64_t _POINTER_MASK = (uint64_t(1) << _POINTER_BITS) - 1;
+
+    static _Node* _pointer(uint64_t tagged);
+
+    static uint64_t _retag(uint64_t previous, _Node* node);
+
+    void _pushNode(_Node* node);
+
+private:
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<uint64_t> _head; // tag << 48 | node address
+};
+
+// ConcurrentStack definition
+
+template<typename _Type>
+ConcurrentStack<_Type>::ConcurrentStack() : _head(0) {}
+
+template<typename _Type>
+ConcurrentStack<_Type>::~ConcurrentStack() {
+    _Node* node = _pointer(_head.load(std::memory_order_acquire));
+    while (node != nullptr) {
+        _Node* next = node->_next;
+        delete node;
+        node = next;
+    }
+}
+
+template<typename _Type>
+bool ConcurrentStack<_Type>::empty() const {
+    return _pointer(_head.load(std::memory_order_acquire)) == nullptr;
+}
+
+template<typename _Type>
+void ConcurrentStack<_Type>::push(const _Type& value) {
+    _pushNode(new _Node(value));
+}
+
+template<typename _Type>
+void ConcurrentStack<_Type>::push(_Type&& value) {
+    _pushNode(new _Node(std::move(value)));
+}
+
+template<typename _Type>
+template<typename... Args>
+void ConcurrentStack<_Type>::emplace(Args&&... args) {
+    _pushNode(new _Node(std::forward<Args>(args)...));
+}
+
+template<typename _Type>
+bool ConcurrentStack<_Type>::try_pop(_Type& value) {
+    EpochReclaimer& reclaimer = EpochReclaimer::instance();
+    _Node* node = nullptr;
+
+    {
+        // pinned while node->_next may be read, so no other thread can free the node under us
+        const EpochReclaimer::Guard guard(reclaimer);
+
+        uint64_t head = _head.load(std::memory_order_acquire);
+        do {
+            node = _pointer(head);
+            if (node == nullptr) {
+                return false;
+            }
+        } while (!_head.compare_exchange_weak(head, _retag(head, node->_next),
+                                              std::memory_order_acquire, std::memory_order_acquire));
+    }
+
+    // the node is unlinked, only this thread owns its value now
+    value = std::move(node->_value);
+    reclaimer.retire(node);
+
+    return true;
+}
+
+template<typename _Type>
+typename ConcurrentStack<_Type>::_Node* ConcurrentStack<_Type>::_pointer(uint64_t tagged) {
+    return reinterpret_cast<_Node*>(tagged & _POINTER_MASK);
+}
+
+template<typename _Type>
+uint64_t ConcurrentStack<_Type>::_retag(uint64_t previous, _Node* node) {
+    const uint64_t tag = (previous >> _POINTER_BITS) + 1;
+    return (tag << _POINTER_BITS) | reinterpret_cast<uint64_t>(node);
+}
+
+template<typename _Type>
+void ConcurrentStack<_Type>::_pushNode(_Node* node) {
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do {
+        node->_next = _pointer(head);
+    } while (!_head.compare_exchange_weak(head, _retag(head, node),
+                                          std::memory_order_release, std::memory_order_relaxed));
+}
+
+#endif // !CONCURRENTSTACK_H
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include "ConcurrentStack.h"
+#include "../Stack/Stack.h"
+#include "../Dynamic_Array/Vector.h"
+
+constexpr size_t MAX_THREADS = 64;
+constexpr size_t TOTAL_OPERATIONS = 1 << 22; // push/pop pairs split across the threads
+constexpr size_t PREFILL = 1024;
+constexpr size_t LATENCY_SAMPLE_INTERVAL = 61; // every n-th pair is timed individually, prime so it does not beat with EPOCH_ADVANCE_INTERVAL
+
+// baseline: the single-threaded Stack behind one mutex
+class LockedStack {
+public:
+    void push(uint64_t value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stack.push(value);
+    }
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stack.empty()) {
+            return false;
+        }
+        value = _stack.top();
+        _stack.pop();
+
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    Stack<uint64_t, Vector<uint64_t>> _stack;
+};
+
+struct Result {
+    double mopsPerSecond;
+    double p50Ns;
+    double p99Ns;
+    uint64_t checksum;
+};
+
+// every thread alternates push and try_pop on a prefilled stack; throughput over all threads plus
+// percentiles of the sampled push+pop pair latency
+template<typename _Stack>
+Result runThreads(size_t threadsCount) {
+    _Stack stack;
+    for (uint64_t i = 0; i < PREFILL; i++) {
+        stack.push(i);
+    }
+
+    const size_t perThread = TOTAL_OPERATIONS / threadsCount;
+    std::atomic<bool> go{ false };
+    std::atomic<uint64_t> checksum{ 0 };
+    std::vector<std::vector<double>> samples(threadsCount);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadsCount; t++) {
+        threads.emplace_back([&, t] {
+            std::vector<double>& mySamples = samples[t];
+            mySamples.reserve(perThread / LATENCY_SAMPLE_INTERVAL + 1);
+            uint64_t sum = 0;
+            uint64_t value = 0;
+
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            for (size_t i = 0; i < perThread; i++) {
+                if (i % LATENCY_SAMPLE_INTERVAL == 0) {
+                    const auto start = std::chrono::steady_clock::now();
+                    stack.push(i);
+                    sum += stack.try_pop(value) ? value : 0;
+                    const auto stop = std::chrono::steady_clock::now();
+                    mySamples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+                } else {
+                    stack.push(i);
+                    sum += stack.try_pop(value) ? value : 0;
+                }
+            }
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    std::vector<double> all;
+    for (const auto& mySamples : samples) {
+        all.insert(all.end(), mySamples.begin(), mySamples.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    return { 2.0 * perThread * threadsCount / ns * 1e3, all[all.size() / 2], all[all.size() * 99 / 100], checksum.load() };
+}
+
+void printRow(const char* name, size_t threadsCount, const Result& result) {
+    std::cout << std::left << std::setw(26) << name << std::right << std::setw(4) << threadsCount << " threads"
+              << std::fixed << std::setprecision(1)
+              << std::setw(10) << result.mopsPerSecond << " Mops/s"
+              << std::setw(10) << result.p50Ns << " ns p50"
+              << std::setw(10) << result.p99Ns << " ns p99"
+              << "   (checksum " << result.checksum << ")" << std::endl;
+}
+
+int main() {
+    std::cout << "STACK CONTENTION (" << TOTAL_OPERATIONS << " push/try_pop pairs split across the threads, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+    for (size_t threadsCount = 1; threadsCount <= MAX_THREADS; threadsCount *= 2) {
+        printRow("mutex + Stack<Vector>", threadsCount, runThreads<LockedStack>(threadsCount));
+        printRow("ConcurrentStack", threadsCount, runThreads<ConcurrentStack<uint64_t>>(threadsCount));
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
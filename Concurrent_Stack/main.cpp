@@ -0,0 +1,79 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+
+#include "ConcurrentStack.h"
+
+int main() {
+    std::ofstream myConcurrentStackTestFile("ConcurrentStackTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myConcurrentStackTestFile << "CONCURRENT STACK\n" << std::endl;
+
+    // single-threaded use
+    {
+        ConcurrentStack<std::string> stack;
+
+        myConcurrentStackTestFile << "Initial empty() = " << std::boolalpha << stack.empty() << std::endl;
+
+        stack.push("first");
+        std::string second = "second";
+        stack.push(second);
+        stack.emplace(5, '*');
+
+        myConcurrentStackTestFile << "After push(\"first\"), push(\"second\"), emplace(5, '*'):";
+        std::string value;
+        while (stack.try_pop(value)) {
+            myConcurrentStackTestFile << " " << value;
+        }
+        myConcurrentStackTestFile << std::endl;
+
+        myConcurrentStackTestFile << "try_pop() on the empty stack = " << stack.try_pop(value) << std::endl;
+    }
+
+    // concurrent producers and consumers, every pushed value must be popped exactly once
+    {
+        const unsigned producersCount = 4;
+        const unsigned consumersCount = 4;
+        const uint64_t pushesPerProducer = 100000;
+
+        ConcurrentStack<uint64_t> stack;
+        std::atomic<uint64_t> poppedSum{ 0 };
+        std::atomic<uint64_t> poppedCount{ 0 };
+        std::vector<std::thread> threads;
+
+        for (unsigned p = 0; p < producersCount; p++) {
+            threads.emplace_back([&stack, p] {
+                for (uint64_t i = 1; i <= pushesPerProducer; i++) {
+                    stack.push(p * pushesPerProducer + i);
+                }
+            });
+        }
+        for (unsigned c = 0; c < consumersCount; c++) {
+            threads.emplace_back([&] {
+                uint64_t value = 0;
+                while (poppedCount.load(std::memory_order_relaxed) < producersCount * pushesPerProducer) {
+                    if (stack.try_pop(value)) {
+                        poppedSum.fetch_add(value, std::memory_order_relaxed);
+                        poppedCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const uint64_t total = producersCount * pushesPerProducer;
+        myConcurrentStackTestFile << "\n4 producers x 100000 push(), 4 consumers try_pop() until all are popped" << std::endl;
+        myConcurrentStackTestFile << "popped " << poppedCount.load() << " values, sum = " << poppedSum.load()
+                                  << ", expected sum = " << total * (total + 1) / 2 << std::endl;
+        myConcurrentStackTestFile << "empty() = " << stack.empty() << std::endl;
+    }
+
+    myConcurrentStackTestFile.close();
+
+    return 0;
+}
@@ -1,45 +1,97 @@
 #ifndef DEQUE_H
 #define DEQUE_H
 
+#include <bit>
+#include <new>
+#include <span>
+#include <cstring>
+#include <utility>
 #include <iostream>
 #include <memory>
 #include <algorithm>
 #include <exception>
+#include <stdexcept>
+#include <type_traits>
+
+// how the iterators of the ring Deque treat misuse
+enum class IteratorPolicy {
+    Checked,    // a deque pointer and a slot: dereferencing into an empty deque or subscripting past it throws
+    Unchecked   // the slots, the mask and a position that never wraps: no checks, so loops over the ring stay tight
+};
 
 namespace constants {
-    constexpr size_t _defaultCapacity = 20;
+    constexpr size_t _defaultCapacity = 16; // a power of two, as every capacity of the ring
     constexpr size_t _capacityGrowthFactor = 2;
 }
 
-template<typename _DequeIterValType, bool _IsConst>
+template<typename _DequeIterValType, bool _IsConst, IteratorPolicy _Policy, typename _Alloc>
 class _DequeIterator;
 
-// interface of custom double-ended queue implemented as circular array
+// selects the bounded constructor of Deque: Deque<int> window(overwrite_oldest, 1000);
+struct overwrite_oldest_t {
+    explicit overwrite_oldest_t() = default;
+};
 
+inline constexpr overwrite_oldest_t overwrite_oldest{};
+
+// count slots of a ring of capacity slots from slot on, as at most two contiguous regions
 template<typename _Type>
+std::pair<std::span<_Type>, std::span<_Type>> _ringSegments(_Type* data, size_t capacity, size_t slot, size_t count) {
+    const size_t firstCount = std::min(count, capacity - slot);
+    return { std::span<_Type>(data + slot, firstCount), std::span<_Type>(data, count - firstCount) };
+}
+
+// interface of custom double-ended queue implemented as circular array.
+// The capacity is always a power of two, so stepping an index or wrapping it around is a mask with
+// _capacity - 1 instead of a branch. One slot always stays empty to tell a full ring from an empty one.
+// Slots are raw storage: an element is constructed when it is pushed and destroyed when it is popped,
+// so growing the ring constructs nothing and _Type needs no default constructor. The slots come from
+// _Alloc, std::allocator by default. Growing relocates the elements with a move-construct and destroy,
+// or with memcpy when _Type is trivially copyable; insert() and erase() shift them over the at most three
+// contiguous pieces the wraparound splits a move into, with memmove when _Type is trivially copyable.
+// A deque constructed with overwrite_oldest never reallocates: once it holds capacity() elements,
+// adding one at the back drops the front (the oldest), adding one at the front drops the back, inserting
+// one in between drops the front, and evicted() counts the dropped elements. Its ring has a slot to spare, so a new element is constructed
+// before the oldest one is destroyed and may be a copy of it.
+// The iterators are checked unless _Policy picks IteratorPolicy::Unchecked. The default does not depend on
+// NDEBUG, so Deque<T> is one type in every translation unit. Unchecked iterators count positions from
+// where the front was when they were taken, so besides what invalidates a std::deque iterator, adding or
+// dropping elements at the front invalidates them too.
+
+template<typename _Type, IteratorPolicy _Policy = IteratorPolicy::Checked, typename _Alloc = std::allocator<_Type>>
 class Deque {
 private: 
-    friend class _DequeIterator<_Type, false>;
-    friend class _DequeIterator<_Type, true>;
+    friend class _DequeIterator<_Type, false, _Policy, _Alloc>;
+    friend class _DequeIterator<_Type, true, _Policy, _Alloc>;
 
 public:
-    using iterator = _DequeIterator<_Type, false>;
-    using const_iterator = _DequeIterator<_Type, true>;
+    using allocator_type = _Alloc;
+    using iterator = _DequeIterator<_Type, false, _Policy, _Alloc>;
+    using const_iterator = _DequeIterator<_Type, true, _Policy, _Alloc>;
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    // the ring as contiguous regions in order, the second one is empty unless the contents wrap around
+    using span_pair = std::pair<std::span<_Type>, std::span<_Type>>;
+    using const_span_pair = std::pair<std::span<const _Type>, std::span<const _Type>>;
 
     // ctors
     Deque();
+
+    explicit Deque(const _Alloc& alloc);
     
-    explicit Deque(size_t count);
+    explicit Deque(size_t count, const _Alloc& alloc = _Alloc());
 
-    Deque(size_t count, const _Type& value);
+    Deque(size_t count, const _Type& value, const _Alloc& alloc = _Alloc());
 
     Deque(const Deque& source);
+    Deque(const Deque& source, const _Alloc& alloc);
 
     Deque(Deque&& source);
 
-    Deque(std::initializer_list<_Type> ilist);
+    Deque(std::initializer_list<_Type> ilist, const _Alloc& alloc = _Alloc());
+
+    // a bounded deque that keeps at most capacity elements
+    Deque(overwrite_oldest_t, size_t capacity, const _Alloc& alloc = _Alloc());
 
     // dtor
     ~Deque();
@@ -80,8 +132,19 @@ public:
 
     size_t size() const;
 
+    // the number of elements the deque can hold before it reallocates, or evicts if it is bounded
+    size_t capacity() const;
+
+    // both keep the ring of a bounded deque as it is
+    void reserve(size_t newCapacity);
+
     void shrink_to_fit();
 
+    bool bounded() const;
+
+    // the number of elements a bounded deque has dropped to make room, since construction
+    size_t evicted() const;
+
     // modifiers
     void clear();
 
@@ -116,266 +179,375 @@ public:
 
     void swap(Deque& other);
 
+    // contiguous access, e.g. for readv/writev without copying through iterators
+    // the elements from front() to back()
+    span_pair as_spans();
+    const_span_pair as_spans() const;
+
+    // count free slots after back(), growing the ring if needed; fill them and then commit() them.
+    // A bounded deque does not grow, it returns at most capacity() - size() slots.
+    // Both need a trivially copyable _Type, as the slots hold no elements until commit()
+    span_pair writable_spans(size_t count);
+
+    // appends the first count slots of writable_spans() to the deque
+    void commit(size_t count);
+
+    // drops the first count elements, e.g. after writev() sent them
+    void consume(size_t count);
+
+    // operations
+    allocator_type get_allocator() const;
+
 private:
-    void _adjustBackWhenMoveRight();
+    using _AllocTraits = std::allocator_traits<_Alloc>;
+
+    size_t _mask() const;
+
+    static size_t _slotsFor(size_t count);
 
-    void _adjustBackWhenMoveLeft();
+    _Type* _allocate(size_t slots);
+
+    void _deallocate(_Type* data, size_t slots);
+
+    // the slot pos places after _front
+    _Type* _slot(size_t pos) const;
 
     void _adjustBacWhenAddNCount(size_t count);
 
-    void _adjustBacWhenSubtrNCount(size_t count);
+    // destroy count elements at the front or the back and move that end past them
+    void _destroyFront(size_t count);
 
-    void _moveRight(const_iterator first, const_iterator last, iterator destFirst);
+    void _destroyBack(size_t count);
 
-    void _moveLeft(const_iterator first, const_iterator last, iterator destFirst);
+    // relocates the elements from pos on count slots towards the back, leaving count raw slots at pos
+    void _openGap(size_t pos, size_t count);
 
-    void _fillValue(iterator first, iterator last, const _Type& value);
+    // moves count elements from position from to position to with move(target, source, pieceCount) over the
+    // contiguous pieces the wraparound splits them into, in an order that reads every element before it is overwritten
+    template<typename _Move>
+    void _shift(size_t from, size_t to, size_t count, _Move move);
 
     void _reAllocMem(size_t newCapacity);
 
+    // grows a full ring; a bounded ring never grows, it always has a free slot
     void _checkForReAlloc();
 
-    iterator _makeIterator(const_iterator where);
+    // drops the front elements of a bounded deque that count elements inserted at pos > 0 would push out
+    // and moves pos back past them; if those are fewer than needed, the first of the inserted ones go too.
+    // Returns how many are left to insert
+    size_t _evictForInsert(size_t& pos, size_t count);
 
 private:
+    [[no_unique_address]] _Alloc _alloc; // the slots come from here, std::allocator by default
     size_t _capacity; // the size of memory allocated to the _data 
     size_t _front; // indicate the front element of the deque object
     size_t _back; // indicate one-past-the-end element of the deque object
     _Type* _data; // the Deque content 
+    size_t _bound; // 0 if the deque grows on demand, else the most elements it keeps
+    size_t _evicted; // the elements dropped by a bounded deque
 };
 
 // Deque definition
 
-template<typename _Type>
-void Deque<_Type>::_adjustBackWhenMoveRight() {
-    _back == _capacity - 1 ? _back = 0 : _back++;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::_mask() const {
+    return _capacity - 1;
 }
 
-template<typename _Type>
-void Deque<_Type>::_adjustBackWhenMoveLeft() {
-    _back == 0 ? _back = _capacity - 1 : _back--;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::_slotsFor(size_t count) {
+    // count elements plus the slot that always stays empty
+    return std::bit_ceil(std::max(count + 1, constants::_defaultCapacity));
 }
 
-template<typename _Type>
-void Deque<_Type>::_adjustBacWhenAddNCount(size_t count) {
-    _back + count >= _capacity ? _back = (_back - _capacity) + count : _back += count; 
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type* Deque<_Type, _Policy, _Alloc>::_allocate(size_t slots) {
+    return _AllocTraits::allocate(_alloc, slots);
 }
 
-template<typename _Type>
-void Deque<_Type>::_adjustBacWhenSubtrNCount(size_t count) {
-    count > _back ? _back = _capacity - (count - _back) : _back -= count;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_deallocate(_Type* data, size_t slots) {
+    if (data != nullptr) {
+        _AllocTraits::deallocate(_alloc, data, slots);
+    }
 }
 
-template<typename _Type>
-void Deque<_Type>::_moveRight(const_iterator first, const_iterator last, iterator destFirst) {
-    for (; first != last; --last, --destFirst) {
-        *destFirst = std::move(*last);
-    }
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type* Deque<_Type, _Policy, _Alloc>::_slot(size_t pos) const {
+    return _data + ((_front + pos) & _mask());
 }
 
-template<typename _Type>
-void Deque<_Type>::_moveLeft(const_iterator first, const_iterator last, iterator destFirst) {
-    for (; first != last; ++first, ++destFirst) {
-        *destFirst = std::move(*first);
-    }
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_adjustBacWhenAddNCount(size_t count) {
+    _back = (_back + count) & _mask();
 }
 
-template<typename _Type>
-void Deque<_Type>::_fillValue(iterator first, iterator last, const _Type& value) {
-    for (; first != last; ++first) {
-        *first = value;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_destroyFront(size_t count) {
+    if constexpr (!std::is_trivially_destructible_v<_Type>) {
+        for (size_t pos = 0; pos < count; pos++) {
+            _slot(pos)->~_Type();
+        }
     }
+
+    _front = (_front + count) & _mask();
 }
 
-template<typename _Type>
-void Deque<_Type>::_reAllocMem(size_t newCapacity) {
-    _Type* newData = new _Type[newCapacity];
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_destroyBack(size_t count) {
+    if constexpr (!std::is_trivially_destructible_v<_Type>) {
+        const size_t newSize = size() - count;
+        for (size_t pos = newSize; pos < newSize + count; pos++) {
+            _slot(pos)->~_Type();
+        }
+    }
+
+    _back = (_back - count) & _mask();
+}
 
-    if (_front <= _back) {
-        for (size_t i = _front; i < _back; i++) {
-            newData[i - _front] = std::move(_data[i]);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_openGap(size_t pos, size_t count) {
+    if constexpr (std::is_trivially_copyable_v<_Type>) {
+        _shift(pos, pos + count, size() - pos, [](_Type* target, _Type* source, size_t pieceCount) {
+            std::memmove(static_cast<void*>(target), source, pieceCount * sizeof(_Type));
+        });
+    } else {
+        // from the back, so every target slot is either past the old back or was vacated already
+        for (size_t i = size(); i-- > pos;) {
+            ::new(static_cast<void*>(_slot(i + count))) _Type(std::move(*_slot(i)));
+            _slot(i)->~_Type();
         }
+    }
+
+    _adjustBacWhenAddNCount(count);
+}
 
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+template<typename _Move>
+void Deque<_Type, _Policy, _Alloc>::_shift(size_t from, size_t to, size_t count, _Move move) {
+    if (to < from) {
+        // towards the front: the pieces go front to back
+        for (size_t done = 0; done < count;) {
+            const size_t source = (_front + from + done) & _mask();
+            const size_t target = (_front + to + done) & _mask();
+            const size_t pieceCount = std::min({ count - done, _capacity - source, _capacity - target });
+            move(_data + target, _data + source, pieceCount);
+            done += pieceCount;
+        }
     } else {
-        for (size_t i = _front; i < _capacity; i++) {
-            newData[i - _front] = std::move(_data[i]);
+        // towards the back: the pieces go back to front, each one ending on the last element left
+        for (size_t left = count; left > 0;) {
+            const size_t source = (_front + from + left - 1) & _mask();
+            const size_t target = (_front + to + left - 1) & _mask();
+            const size_t pieceCount = std::min({ left, source + 1, target + 1 });
+            move(_data + target + 1 - pieceCount, _data + source + 1 - pieceCount, pieceCount);
+            left -= pieceCount;
         }
+    }
+}
 
-        for (size_t i = 0; i < _back; i++) {
-            newData[_capacity - _front + i] = std::move(_data[i]);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_reAllocMem(size_t newCapacity) {
+    _Type* newData = _allocate(newCapacity);
+
+    const size_t count = size();
+    if constexpr (std::is_trivially_copyable_v<_Type>) {
+        // at most two contiguous regions to copy
+        const span_pair spans = as_spans();
+        if (!spans.first.empty()) {
+            std::memcpy(newData, spans.first.data(), spans.first.size() * sizeof(_Type));
+        }
+        if (!spans.second.empty()) {
+            std::memcpy(newData + spans.first.size(), spans.second.data(), spans.second.size() * sizeof(_Type));
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            ::new(static_cast<void*>(newData + i)) _Type(std::move(*_slot(i)));
+            _slot(i)->~_Type();
         }
     }
 
-    delete[] _data;
-    
-    // Note: first reset _back then _front!
-    _back = size();
+    _deallocate(_data, _capacity);
 
+    _back = count;
     _front = 0;
     _data = newData;
     _capacity = newCapacity;
 }
 
-template<typename _Type>
-void Deque<_Type>::_checkForReAlloc() {
-    if (size() + 1 >= _capacity) {
-        _reAllocMem(_capacity * constants::_capacityGrowthFactor);
-    } else if (_capacity == 0) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::_checkForReAlloc() {
+    if (_bound != 0) {
+        return;
+    }
+
+    if (_capacity == 0) {
         _reAllocMem(constants::_defaultCapacity);
+    } else if (size() + 1 >= _capacity) {
+        _reAllocMem(_capacity * constants::_capacityGrowthFactor);
     }
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::_makeIterator(const_iterator where) {
-    iterator deqIt;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::_evictForInsert(size_t& pos, size_t count) {
+    if (size() + count <= _bound) {
+        return count;
+    }
+
+    const size_t excess = size() + count - _bound;
+    const size_t dropped = std::min(excess, pos);
 
-    deqIt._dequePtr = this;
-    deqIt._offset = where._offset;
+    _destroyFront(dropped);
+    _evicted += excess;
+    pos -= dropped;
 
-    return deqIt;
+    return count - (excess - dropped);
 }
 
-template<typename _Type>
-Deque<_Type>::Deque() : 
-    _capacity(constants::_defaultCapacity), _front(0), _back(0), _data(new _Type[constants::_defaultCapacity]) {}
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque() : 
+    _alloc(), _capacity(constants::_defaultCapacity), _front(0), _back(0), _data(_allocate(constants::_defaultCapacity)),
+    _bound(0), _evicted(0) {}
 
-template<typename _Type>
-Deque<_Type>::Deque(size_t count) : 
-    _capacity(constants::_defaultCapacity), _front(0), _back(count), _data(new _Type[constants::_defaultCapacity]) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(const _Alloc& alloc) : 
+    _alloc(alloc), _capacity(constants::_defaultCapacity), _front(0), _back(0), _data(_allocate(constants::_defaultCapacity)),
+    _bound(0), _evicted(0) {}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(size_t count, const _Alloc& alloc) : 
+    _alloc(alloc), _capacity(_slotsFor(count)), _front(0), _back(count), _data(_allocate(_capacity)), _bound(0), _evicted(0) {
 
     for (size_t i = 0; i < count; i++) {
-        _data[i] = _Type();
+        ::new(static_cast<void*>(_data + i)) _Type();
     }
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(size_t count, const _Type& value) : 
-    _capacity(constants::_defaultCapacity), _front(0), _back(count), _data(new _Type[constants::_defaultCapacity]) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(size_t count, const _Type& value, const _Alloc& alloc) : 
+    _alloc(alloc), _capacity(_slotsFor(count)), _front(0), _back(count), _data(_allocate(_capacity)), _bound(0), _evicted(0) {
 
     for (size_t i = 0; i < count; i++) {
-        _data[i] = value;
+        ::new(static_cast<void*>(_data + i)) _Type(value);
     }
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(const Deque& source) : 
-    _capacity(source._capacity), _front(source._front), _back(source._back), _data(new _Type[source._capacity]) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(const Deque& source) : 
+    Deque(source, _AllocTraits::select_on_container_copy_construction(source._alloc)) {}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(const Deque& source, const _Alloc& alloc) : 
+    _alloc(alloc), _capacity(source._capacity), _front(source._front), _back(source._back), _data(_allocate(source._capacity)),
+    _bound(source._bound), _evicted(source._evicted) {
 
-    for (size_t i = _front; i < _back; i++) {
-        _data[i] = source._data[i];
+    for (size_t i = _front; i != _back; i = (i + 1) & _mask()) {
+        ::new(static_cast<void*>(_data + i)) _Type(source._data[i]);
     }
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(Deque&& source) : _capacity(0), _front(0), _back(0), _data(nullptr) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(Deque&& source) : 
+    _alloc(source._alloc), _capacity(0), _front(0), _back(0), _data(nullptr), _bound(0), _evicted(0) {
     *this = std::move(source);
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(std::initializer_list<_Type> ilist) :
-    _capacity(ilist.size() + constants::_defaultCapacity), _front(0), _back(ilist.size()), _data(new _Type[_capacity]) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(std::initializer_list<_Type> ilist, const _Alloc& alloc) :
+    _alloc(alloc), _capacity(_slotsFor(ilist.size())), _front(0), _back(ilist.size()), _data(_allocate(_capacity)), _bound(0), _evicted(0) {
     
-    std::copy(ilist.begin(), ilist.end(), _data);
+    std::uninitialized_copy(ilist.begin(), ilist.end(), _data);
 }
 
-template<typename _Type>
-Deque<_Type>::~Deque() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::Deque(overwrite_oldest_t, size_t capacity, const _Alloc& alloc) :
+    _alloc(alloc), _capacity(_slotsFor(capacity + 1)), _front(0), _back(0), _data(_allocate(_capacity)), _bound(capacity), _evicted(0) {
+
+    if (capacity == 0) {
+        _deallocate(_data, _capacity);
+        throw std::length_error("Deque Error: A bounded deque needs a capacity!");
+    }
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>::~Deque() {
     clear();
-    delete[] _data;
+    _deallocate(_data, _capacity);
     _data = nullptr;
 }
 
-template<typename _Type>
-Deque<_Type>& Deque<_Type>::operator=(const Deque& right) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>& Deque<_Type, _Policy, _Alloc>::operator=(const Deque& right) {
     if (this != std::addressof(right)) {
-        if (_data) {
-            delete[] _data;
-            _data = nullptr;
-        }
-        
-        _capacity = right._capacity;
-        _front = right._front;
-        _back = right._back;
-        _data = new _Type[right._capacity];
-
-        std::copy(right._data, right._data + right._capacity, _data);
+        // only the live slots of right hold elements to copy; the copy comes from the allocator this deque
+        // keeps, which is right's if the allocator propagates on copy assignment
+        Deque copy(right, _AllocTraits::propagate_on_container_copy_assignment::value ? right._alloc : _alloc);
+        swap(copy);
     }
 
     return *this;
 }
 
-template<typename _Type>
-Deque<_Type>& Deque<_Type>::operator=(Deque&& right) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+Deque<_Type, _Policy, _Alloc>& Deque<_Type, _Policy, _Alloc>::operator=(Deque&& right) {
     if (this != std::addressof(right)) {
         if (_data) {
-            delete[] _data;
+            clear();
+            _deallocate(_data, _capacity);
             _data = nullptr;
         }
 
+        // the slots move over, so the allocator that owns them has to come along
+        _alloc = right._alloc;
         _capacity = right._capacity;
         _front = right._front;
         _back = right._back;
         _data = right._data;
+        _bound = right._bound;
+        _evicted = right._evicted;
 
+        // the moved-from deque is left empty and grows again on demand
         right._data = nullptr;
         right._back = 0;
         right._front = 0;
         right._capacity = 0;
+        right._bound = 0;
+        right._evicted = 0;
     }
 
     return *this;
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::at(size_t pos) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type& Deque<_Type, _Policy, _Alloc>::at(size_t pos) {
     if (pos >= size()) {
         throw std::out_of_range("Deque Error: Index out of bounds!");
     }
 
-    pos += _front;
-    if (pos >= _capacity) {
-        pos -= _capacity;
-    }
-
-    return _data[pos];
+    return _data[(_front + pos) & _mask()];
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::at(size_t pos) const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+const _Type& Deque<_Type, _Policy, _Alloc>::at(size_t pos) const {
     if (pos >= size()) {
         throw std::out_of_range("Deque Error: Index out of bounds!");
     }
 
-    pos += _front;
-    if (pos >= _capacity) {
-        pos -= _capacity;
-    }
-
-    return _data[pos];
+    return _data[(_front + pos) & _mask()];
 }
 
-template<typename _Type> 
-_Type& Deque<_Type>::operator[](size_t pos) {
-    pos += _front;
-    if (pos >= _capacity) {
-        pos -= _capacity;
-    }
-
-    return _data[pos];
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type& Deque<_Type, _Policy, _Alloc>::operator[](size_t pos) {
+    return _data[(_front + pos) & _mask()];
 }
 
-template<typename _Type> 
-const _Type& Deque<_Type>::operator[](size_t pos) const {
-    pos += _front;
-    if (pos >= _capacity) {
-        pos -= _capacity;
-    }
-
-    return _data[pos];
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+const _Type& Deque<_Type, _Policy, _Alloc>::operator[](size_t pos) const {
+    return _data[(_front + pos) & _mask()];
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::front() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type& Deque<_Type, _Policy, _Alloc>::front() {
     if (empty()) {
         std::cerr << "front() called on empty deque" << std::endl;
     }
@@ -383,8 +555,8 @@ _Type& Deque<_Type>::front() {
     return _data[_front];
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::front() const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+const _Type& Deque<_Type, _Policy, _Alloc>::front() const {
     if (empty()) {
         std::cerr << "front() called on empty deque" << std::endl;
     }
@@ -392,286 +564,289 @@ const _Type& Deque<_Type>::front() const {
     return _data[_front];
 }
 
-template<typename _Type> 
-_Type& Deque<_Type>::back() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+_Type& Deque<_Type, _Policy, _Alloc>::back() {
     if (empty()) {
         std::cerr << "back() called on empty deque" << std::endl;
     }
 
-    return _data[_back - 1];
+    return _data[(_back - 1) & _mask()];
 }
 
-template<typename _Type> 
-const _Type& Deque<_Type>::back() const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+const _Type& Deque<_Type, _Policy, _Alloc>::back() const {
     if (empty()) {
         std::cerr << "back() called on empty deque" << std::endl;
     }
 
-    return _data[_back - 1];
+    return _data[(_back - 1) & _mask()];
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::begin() {
-    iterator deqIt;
-
-    deqIt._dequePtr = this;
-    deqIt._offset = _front;
-
-    return deqIt;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::begin() {
+    return iterator(*this, 0);
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_iterator Deque<_Type>::cbegin() const {
-    const_iterator cdeqIt;
-
-    cdeqIt._dequePtr = this;
-    cdeqIt._offset = _front;
-
-    return cdeqIt;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::const_iterator Deque<_Type, _Policy, _Alloc>::cbegin() const {
+    return const_iterator(*this, 0);
 }
 
-template<typename _Type> 
-typename Deque<_Type>::iterator Deque<_Type>::end() {
-    iterator deqIt;
-
-    deqIt._dequePtr = this;
-    deqIt._offset = _back;
-
-    return deqIt;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::end() {
+    return iterator(*this, size());
 }
 
-template<typename _Type> 
-typename Deque<_Type>::const_iterator Deque<_Type>::cend() const {
-    const_iterator cdeqIt;
-
-    cdeqIt._dequePtr = this;
-    cdeqIt._offset = _back;
-
-    return cdeqIt;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::const_iterator Deque<_Type, _Policy, _Alloc>::cend() const {
+    return const_iterator(*this, size());
 }
 
-template<typename _Type>
-typename Deque<_Type>::reverse_iterator Deque<_Type>::rbegin() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::reverse_iterator Deque<_Type, _Policy, _Alloc>::rbegin() {
     return reverse_iterator(end());
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_reverse_iterator Deque<_Type>::crbegin() const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::const_reverse_iterator Deque<_Type, _Policy, _Alloc>::crbegin() const {
     return const_reverse_iterator(cend());
 }
 
-template<typename _Type>
-typename Deque<_Type>::reverse_iterator Deque<_Type>::rend() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::reverse_iterator Deque<_Type, _Policy, _Alloc>::rend() {
     return reverse_iterator(begin());
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_reverse_iterator Deque<_Type>::crend() const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::const_reverse_iterator Deque<_Type, _Policy, _Alloc>::crend() const {
     return const_reverse_iterator(cbegin());
 }
 
-template<typename _Type>
-bool Deque<_Type>::empty() const {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+bool Deque<_Type, _Policy, _Alloc>::empty() const {
     return size() == 0;
 }
 
-template<typename _Type>
-size_t Deque<_Type>::size() const {
-    return _back >= _front ? _back - _front : (_capacity - _front) + _back;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::size() const {
+    return (_back - _front) & _mask();
 }
 
-template<typename _Type>
-void Deque<_Type>::shrink_to_fit() {
-    _Type* newData = new _Type[size() + 1];
-    std::move(begin(), end(), newData);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::capacity() const {
+    if (_bound != 0) {
+        return _bound;
+    }
 
-    delete[] _data;
+    return _capacity == 0 ? 0 : _capacity - 1;
+}
 
-    _capacity = size() + 1;
-    _front = 0;
-    _back = size();
-    _data = newData;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::reserve(size_t newCapacity) {
+    if (_bound == 0 && newCapacity > capacity()) {
+        _reAllocMem(_slotsFor(newCapacity));
+    }
 }
 
-template<typename _Type>
-void Deque<_Type>::clear() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::shrink_to_fit() {
+    if (_bound == 0 && _slotsFor(size()) < _capacity) {
+        _reAllocMem(_slotsFor(size()));
+    }
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+bool Deque<_Type, _Policy, _Alloc>::bounded() const {
+    return _bound != 0;
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+size_t Deque<_Type, _Policy, _Alloc>::evicted() const {
+    return _evicted;
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::clear() {
+    _destroyBack(size());
     _front = 0;
     _back = 0;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, const _Type& value) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::insert(const_iterator where, const _Type& value) {
     return emplace(where, value);
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, _Type&& value) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::insert(const_iterator where, _Type&& value) {
     return emplace(where, std::move(value));
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, size_t count, const _Type& value) {
-    iterator deqIt = _makeIterator(where);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::insert(const_iterator where, size_t count, const _Type& value) {
+    // Note: positions survive a memory reallocation or a move of the front, DequeIterator offsets do not
+    size_t pos = static_cast<size_t>(where - cbegin());
+    if (_bound != 0 && pos == 0 && count > 0) {
+        // at the front they drop the back, as with push_front(); value may be one of the dropped elements
+        const _Type copy(value);
+        const size_t kept = std::min(count, _bound);
+        _evicted += count - kept;
+        for (size_t i = 0; i < kept; i++) {
+            emplace_front(copy);
+        }
+        return begin();
+    }
+
+    if (_bound != 0) {
+        count = _evictForInsert(pos, count);
+    }
 
     if (count == 0) {
-        return deqIt;
+        return begin() + pos;
     }
 
     if (size() + count >= _capacity) {
-        where._offset = _front - where._offset;
-        _reAllocMem(count + (_capacity * constants::_capacityGrowthFactor));
+        _reAllocMem(std::max(_slotsFor(size() + count), _capacity * constants::_capacityGrowthFactor));
     }
 
-    _moveRight(--where, cend(), end() + count);
-    _adjustBacWhenAddNCount(count);
-    _fillValue(deqIt, deqIt + count, value);
-    
-    return deqIt;
+    _openGap(pos, count);
+    const span_pair gap = _ringSegments(_data, _capacity, (_front + pos) & _mask(), count);
+    std::uninitialized_fill(gap.first.begin(), gap.first.end(), value);
+    std::uninitialized_fill(gap.second.begin(), gap.second.end(), value);
+
+    return begin() + pos;
 }
 
-template<typename _Type>
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
 template<typename... Args>
-typename Deque<_Type>::iterator Deque<_Type>::emplace(const_iterator where, Args&&...args) {
-    if (size() + 1 >= _capacity) {
-        // Note: in case of memory reallocation DequeIterator position must adjust according to the new _front
-        where._offset = _front - where._offset;
-        _reAllocMem(_capacity * constants::_capacityGrowthFactor);
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::emplace(const_iterator where, Args&&...args) {
+    size_t pos = static_cast<size_t>(where - cbegin());
+
+    // at the front the new element drops the back of a full bounded deque, as with push_front()
+    if (pos == 0) {
+        emplace_front(std::forward<Args>(args)...);
+        return begin();
     }
 
-    iterator deqIt = _makeIterator(where);
+    if (_bound != 0) {
+        _evictForInsert(pos, 1);
+    }
 
-    if (where == cbegin()) {
-        emplace_front(std::forward<Args>(args)...);
-        return deqIt;
-    } else if (where == cend()) {
+    if (pos == size()) {
         emplace_back(std::forward<Args>(args)...);
-        return deqIt;
+        return end() - 1;
     }
 
-    _moveRight(--where, cend(), end() + 1);
-    _adjustBackWhenMoveRight();
-
-    *deqIt = _Type(std::forward<Args>(args)...);
+    _checkForReAlloc();
+    _openGap(pos, 1);
+    ::new(static_cast<void*>(_slot(pos))) _Type(std::forward<Args>(args)...);
 
-    return deqIt;
+    return begin() + pos;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator where) {
-    iterator deqIt = _makeIterator(where);
-
-    // Note: cend() must be one-past-the-end offset to move properly all elements
-    _moveLeft(++where, ++cend(), deqIt);
-    _adjustBackWhenMoveLeft();
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::erase(const_iterator where) {
+    return erase(where, where + 1);
+}
 
-    return deqIt;
-} 
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::iterator Deque<_Type, _Policy, _Alloc>::erase(const_iterator first, const_iterator last) {
+    const size_t pos = static_cast<size_t>(first - cbegin());
+    const size_t count = static_cast<size_t>(last - first);
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator first, const_iterator last) {
-    iterator deqIt = _makeIterator(first);
+    // an empty range would shift every element after pos onto itself
+    if (count == 0) {
+        return begin() + pos;
+    }
 
-    _moveLeft(last, cend(), deqIt);
-    _adjustBacWhenSubtrNCount(static_cast<size_t>(last - first));
+    _shift(pos + count, pos, size() - pos - count, [](_Type* target, _Type* source, size_t pieceCount) {
+        if constexpr (std::is_trivially_copyable_v<_Type>) {
+            std::memmove(static_cast<void*>(target), source, pieceCount * sizeof(_Type));
+        } else {
+            std::move(source, source + pieceCount, target);
+        }
+    });
+    _destroyBack(count);
 
-    return deqIt;
+    return begin() + pos;
 }
 
-template<typename _Type>
-void Deque<_Type>::push_back(const _Type& value) {
-    _checkForReAlloc();
-
-    if (_back == _capacity - 1) {
-        _back = 0;
-    }
-     
-    _data[_back++] = value;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::push_back(const _Type& value) {
+    emplace_back(value);
 }
 
-template<typename _Type>
-void Deque<_Type>::push_back(_Type&& value) {
-    _checkForReAlloc();
-
-    if (_back == _capacity - 1) {
-        _back = 0;
-    }
-     
-    _data[_back++] = std::move(value);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::push_back(_Type&& value) {
+    emplace_back(std::move(value));
 }
 
-template<typename _Type> 
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
 template<typename... Args>
-_Type& Deque<_Type>::emplace_back(Args&&... args) {
+_Type& Deque<_Type, _Policy, _Alloc>::emplace_back(Args&&... args) {
     _checkForReAlloc();
 
-    if (_back < _capacity) {
-        _data[_back++] = _Type(std::forward<Args>(args)...);
-        return back();
+    _Type* element = ::new(static_cast<void*>(_data + _back)) _Type(std::forward<Args>(args)...);
+    _back = (_back + 1) & _mask();
+
+    if (_bound != 0 && size() > _bound) {
+        _destroyFront(1);
+        _evicted++;
     }
 
-    _back = 0;
-    _data[_back] = _Type(std::forward<Args>(args)...);
-    return back();
+    return *element;
 }
 
-template<typename _Type>
-void Deque<_Type>::pop_back() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::pop_back() {
     if (empty()) {
         std::cerr << "pop_back() called on empty deque" << std::endl;
+        return;
     }
 
-    erase(cend() - 1);
+    _destroyBack(1);
 }
 
-template<typename _Type>
-void Deque<_Type>::push_front(const _Type& value) {
-    _checkForReAlloc();
-
-    if (_front == 0) {
-        _front = _capacity;
-    }
-
-    _data[--_front] = value;
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::push_front(const _Type& value) {
+    emplace_front(value);
 }
 
-template<typename _Type>
-void Deque<_Type>::push_front(_Type&& value) {
-    _checkForReAlloc();
-
-    if (_front == 0) {
-        _front = _capacity;
-    }
-
-    _data[--_front] = std::move(value);
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::push_front(_Type&& value) {
+    emplace_front(std::move(value));
 }
 
-template<typename _Type>
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
 template<typename... Args>
-_Type& Deque<_Type>::emplace_front(Args&&... args) {
+_Type& Deque<_Type, _Policy, _Alloc>::emplace_front(Args&&... args) {
     _checkForReAlloc();
 
-    if (_front > 0) {
-        _data[--_front] = _Type(std::forward<Args>(args)...);
-        return front();
+    _Type* element = ::new(static_cast<void*>(_data + ((_front - 1) & _mask()))) _Type(std::forward<Args>(args)...);
+    _front = (_front - 1) & _mask();
+
+    if (_bound != 0 && size() > _bound) {
+        _destroyBack(1);
+        _evicted++;
     }
 
-    _front = _capacity - 1;
-    _data[_front] = _Type(std::forward<Args>(args)...);
-    return front();
+    return *element;
 }
 
-template<typename _Type>
-void Deque<_Type>::pop_front() {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::pop_front() {
     if (empty()) {
         std::cerr << "pop_front() called on empty deque" << std::endl;
+        return;
     }
 
-    erase(cbegin());
+    _destroyFront(1);
 }
 
-template<typename _Type>
-void Deque<_Type>::resize(size_t newSize) {
-    while (size() < newSize) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::resize(size_t newSize) {
+    // counted, since a bounded deque never grows past capacity()
+    for (size_t count = size(); count < newSize; count++) {
         emplace_back();
     }
 
@@ -680,9 +855,9 @@ void Deque<_Type>::resize(size_t newSize) {
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::resize(size_t newSize, const _Type& value) {
-    while (size() < newSize) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::resize(size_t newSize, const _Type& value) {
+    for (size_t count = size(); count < newSize; count++) {
         emplace_back(value);
     }
 
@@ -691,25 +866,77 @@ void Deque<_Type>::resize(size_t newSize, const _Type& value) {
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::swap(Deque& other) {
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::swap(Deque& other) {
     if (this != std::addressof(other)) {
+        std::swap(_alloc, other._alloc);
         std::swap(_data, other._data);
         std::swap(_capacity, other._capacity);
         std::swap(_front, other._front);
         std::swap(_back, other._back);
+        std::swap(_bound, other._bound);
+        std::swap(_evicted, other._evicted);
+    }
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::span_pair Deque<_Type, _Policy, _Alloc>::as_spans() {
+    return _ringSegments(_data, _capacity, _front, size());
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::const_span_pair Deque<_Type, _Policy, _Alloc>::as_spans() const {
+    return _ringSegments<const _Type>(_data, _capacity, _front, size());
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::span_pair Deque<_Type, _Policy, _Alloc>::writable_spans(size_t count) {
+    static_assert(std::is_trivially_copyable_v<_Type>, "Deque Error: writable_spans() needs a trivially copyable element type!");
+
+    if (_bound != 0) {
+        count = std::min(count, _bound - size());
+    }
+    reserve(size() + count);
+
+    return _ringSegments(_data, _capacity, _back, count);
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::commit(size_t count) {
+    static_assert(std::is_trivially_copyable_v<_Type>, "Deque Error: commit() needs a trivially copyable element type!");
+
+    if (count > capacity() - size()) {
+        throw std::length_error("Deque Error: Commit past the writable slots!");
+    }
+
+    _adjustBacWhenAddNCount(count);
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void Deque<_Type, _Policy, _Alloc>::consume(size_t count) {
+    if (count > size()) {
+        throw std::out_of_range("Deque Error: Consume past the last element!");
     }
+
+    _destroyFront(count);
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+typename Deque<_Type, _Policy, _Alloc>::allocator_type Deque<_Type, _Policy, _Alloc>::get_allocator() const {
+    return _alloc;
 }
 
 // definition of random access deque iterator class
 
-template<typename _DequeIterValType, bool _IsConst>
+template<typename _DequeIterValType, bool _IsConst, IteratorPolicy _Policy, typename _Alloc>
 class _DequeIterator {
 private:
-    friend class Deque<_DequeIterValType>;
+    friend class Deque<_DequeIterValType, _Policy, _Alloc>;
+
+    using _DequeType = std::conditional_t<_IsConst, const Deque<_DequeIterValType, _Policy, _Alloc>, Deque<_DequeIterValType, _Policy, _Alloc>>;
 
 public:
-    using _Self = _DequeIterator<_DequeIterValType, _IsConst>;
+    using _Self = _DequeIterator<_DequeIterValType, _IsConst, _Policy, _Alloc>;
 
     using iterator_category = std::random_access_iterator_tag;
     using value_type = _DequeIterValType;
@@ -720,7 +947,7 @@ public:
     // ctors
     _DequeIterator() : _dequePtr(nullptr), _offset(0) {}
 
-    _DequeIterator(const Deque<value_type>& deque) : _dequePtr(&deque), _offset(0) {}
+    _DequeIterator(const Deque<value_type, _Policy, _Alloc>& deque) : _dequePtr(&deque), _offset(0) {}
 
     _DequeIterator(const _Self& other) : _dequePtr(other._dequePtr), _offset(other._offset) {}
 
@@ -783,64 +1010,44 @@ public:
 
     template<bool _Const = _IsConst>
     std::enable_if_t<_Const, reference> operator[](size_t index) const {
-        if (index >= _dequePtr->size()) {
+        const size_t pos = ((_offset - _dequePtr->_front) & _dequePtr->_mask()) + index;
+        if (pos >= _dequePtr->size()) {
             throw std::out_of_range("DequeIterator Error: Index out of bounds");
         }
 
-        return _dequePtr->operator[](index);
+        return _dequePtr->operator[](pos);
     }
 
     template<bool _Const = _IsConst>
     std::enable_if_t<!_Const, reference> operator[](size_t index) const {
-        if (index >= _dequePtr->size()) {
+        const size_t pos = ((_offset - _dequePtr->_front) & _dequePtr->_mask()) + index;
+        if (pos >= _dequePtr->size()) {
             throw std::out_of_range("DequeIterator Error: Index out of bounds");
         }
 
-        return _dequePtr->operator[](index);
+        return _dequePtr->operator[](pos);
     }
 
     // iterator increment and decrement
     _Self& operator++() { // prefix
-        if (_offset + 1 >= _dequePtr->_capacity) {
-            _offset = 0;
-        } else {
-            ++_offset;
-        }
-
+        _offset = (_offset + 1) & _dequePtr->_mask();
         return *this;
     }
 
     _Self operator++(int) { // postfix
         _Self tmp = *this;
-
-        if (_offset + 1 >= _dequePtr->_capacity) {
-            _offset = 0;
-        } else {
-            ++_offset;
-        }
-
+        _offset = (_offset + 1) & _dequePtr->_mask();
         return tmp;
     }
 
     _Self& operator--() { // prefix
-        if (_offset == 0) {
-            _offset = _dequePtr->_capacity - 1;
-        } else {
-            --_offset;
-        }
-
+        _offset = (_offset - 1) & _dequePtr->_mask();
         return *this;
     }
 
     _Self operator--(int) { // postfix
         _Self tmp = *this;
-
-        if (_offset == 0) {
-            _offset = _dequePtr->_capacity - 1;
-        } else {
-            --_offset;
-        }
-
+        _offset = (_offset - 1) & _dequePtr->_mask();
         return tmp;
     }
 
@@ -850,7 +1057,7 @@ public:
         return *this;
     }
 
-    _Self operator+(const difference_type off) {
+    _Self operator+(const difference_type off) const {
         _Self tmp = *this;
         _findOffsetWhenAdd(tmp, off);
         return tmp;
@@ -865,60 +1072,162 @@ public:
         return *this;
     }
 
-    _Self operator-(const difference_type off) {
+    _Self operator-(const difference_type off) const {
         _Self tmp = *this;
         _findOffsetWhenSubtr(tmp, off);
         return tmp;
     }
 
     difference_type operator-(const _Self& right) const {
-        size_t diff{};
-        
-        if (right._offset < _offset) {
-            diff = _offset - right._offset;
-        } else {
-            diff = (_dequePtr->_capacity - right._offset) + _offset;
-        }
+        // positions are measured from _front, so an iterator past the wraparound still compares as later
+        const size_t mask = _dequePtr->_mask();
+        const size_t front = _dequePtr->_front;
 
-        return static_cast<difference_type>(diff);
+        return static_cast<difference_type>(((_offset - front) & mask) - ((right._offset - front) & mask));
+    }
+
+    // the elements from this iterator to last as at most two contiguous regions, see DequeAlgorithms.h
+    std::pair<std::span<value_type>, std::span<value_type>> _segments(const _Self& last) const requires (!_IsConst) {
+        return _ringSegments(_dequePtr->_data, _dequePtr->_capacity, _offset, static_cast<size_t>(last - *this));
+    }
+
+    std::pair<std::span<const value_type>, std::span<const value_type>> _segments(const _Self& last) const requires _IsConst {
+        return _ringSegments<const value_type>(_dequePtr->_data, _dequePtr->_capacity, _offset, static_cast<size_t>(last - *this));
     }
 
 private:
-    void _findOffsetWhenSubtr(_Self& it, const difference_type off) {
-        if (it._dequePtr->_front < it._dequePtr->_back) {
-            if (it._offset - off < it._dequePtr->_front) {
-                it._offset = it._dequePtr->_back - ((it._offset - it._dequePtr->_front) - off);
-            } else {
-                it._offset -= off;
-            }
-        } else {
-            if (it._offset - off >= 0) {
-                it._offset -= off;
-            } else {
-                it._offset = it._dequePtr->_capacity - (off - it._offset);
-            }
-        }
+    // the iterator pos elements after the front of deque
+    _DequeIterator(_DequeType& deque, size_t pos) : _dequePtr(&deque), _offset((deque._front + pos) & deque._mask()) {}
+
+    static void _findOffsetWhenSubtr(_Self& it, const difference_type off) {
+        it._offset = (it._offset - static_cast<size_t>(off)) & it._dequePtr->_mask();
     }
 
-    void _findOffsetWhenAdd(_Self& it, const difference_type off) {
-        if (it._dequePtr->_front < it._dequePtr->_back) {
-            if (it._offset + off >= it._dequePtr->_capacity) {
-                it._offset = (it._dequePtr->_back - it._dequePtr->_capacity) + off;
-            } else {
-                it._offset += off;
-            }
-        } else {
-            if (it._offset + off < it._dequePtr->_capacity) {
-                it._offset += off;
-            } else {
-                it._offset = (it._dequePtr->_front - it._dequePtr->_capacity) + off;
-            }
-        }
+    static void _findOffsetWhenAdd(_Self& it, const difference_type off) {
+        it._offset = (it._offset + static_cast<size_t>(off)) & it._dequePtr->_mask();
     }
 
 protected:
-    std::conditional_t<_IsConst, const Deque<value_type>*, Deque<value_type>*> _dequePtr{}; // this is the deque the iterator is bound to
+    _DequeType* _dequePtr{}; // this is the deque the iterator is bound to
     size_t _offset{}; // posistion of the iterator
 };
 
+// the unchecked iterator copies what it needs out of the deque, so stepping it touches no deque member.
+// _offset is not wrapped, only the slot it dereferences is; two iterators then compare and subtract as
+// plain integers, which holds as long as the front has not moved since they were taken
+
+template<typename _DequeIterValType, bool _IsConst, typename _Alloc>
+class _DequeIterator<_DequeIterValType, _IsConst, IteratorPolicy::Unchecked, _Alloc> {
+private:
+    friend class Deque<_DequeIterValType, IteratorPolicy::Unchecked, _Alloc>;
+
+    using _DequeType = std::conditional_t<_IsConst, const Deque<_DequeIterValType, IteratorPolicy::Unchecked, _Alloc>,
+                                          Deque<_DequeIterValType, IteratorPolicy::Unchecked, _Alloc>>;
+
+public:
+    using _Self = _DequeIterator<_DequeIterValType, _IsConst, IteratorPolicy::Unchecked, _Alloc>;
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = _DequeIterValType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional_t<_IsConst, const value_type*, value_type*>;
+    using reference = typename std::conditional_t<_IsConst, const value_type&, value_type&>;
+
+    // ctors
+    _DequeIterator() : _data(nullptr), _mask(0), _offset(0) {}
+
+    // operator overloads
+    bool operator==(const _Self& right) const {
+        return _offset == right._offset;
+    }
+
+    bool operator!=(const _Self& right) const {
+        return !(*this == right);
+    }
+
+    reference operator*() const {
+        return _data[_offset & _mask];
+    }
+
+    pointer operator->() const {
+        return _data + (_offset & _mask);
+    }
+
+    reference operator[](size_t index) const {
+        return _data[(_offset + index) & _mask];
+    }
+
+    // iterator increment and decrement
+    _Self& operator++() { // prefix
+        ++_offset;
+        return *this;
+    }
+
+    _Self operator++(int) { // postfix
+        _Self tmp = *this;
+        ++_offset;
+        return tmp;
+    }
+
+    _Self& operator--() { // prefix
+        --_offset;
+        return *this;
+    }
+
+    _Self operator--(int) { // postfix
+        _Self tmp = *this;
+        --_offset;
+        return tmp;
+    }
+
+    // pointer arithmetic
+    _Self& operator+=(const difference_type off) {
+        _offset += static_cast<size_t>(off);
+        return *this;
+    }
+
+    _Self operator+(const difference_type off) const {
+        _Self tmp = *this;
+        tmp._offset += static_cast<size_t>(off);
+        return tmp;
+    }
+
+    difference_type operator+(const _Self& right) const {
+        return static_cast<difference_type>(_offset + right._offset);
+    }
+
+    _Self& operator-=(const difference_type off) {
+        _offset -= static_cast<size_t>(off);
+        return *this;
+    }
+
+    _Self operator-(const difference_type off) const {
+        _Self tmp = *this;
+        tmp._offset -= static_cast<size_t>(off);
+        return tmp;
+    }
+
+    difference_type operator-(const _Self& right) const {
+        return static_cast<difference_type>(_offset - right._offset);
+    }
+
+    // the elements from this iterator to last as at most two contiguous regions, see DequeAlgorithms.h
+    std::pair<std::span<value_type>, std::span<value_type>> _segments(const _Self& last) const requires (!_IsConst) {
+        return _ringSegments(_data, _mask + 1, _offset & _mask, last._offset - _offset);
+    }
+
+    std::pair<std::span<const value_type>, std::span<const value_type>> _segments(const _Self& last) const requires _IsConst {
+        return _ringSegments(_data, _mask + 1, _offset & _mask, last._offset - _offset);
+    }
+
+private:
+    // the iterator pos elements after the front of deque
+    _DequeIterator(_DequeType& deque, size_t pos) : _data(deque._data), _mask(deque._mask()), _offset(deque._front + pos) {}
+
+private:
+    pointer _data; // the slots of the deque
+    size_t _mask; // the capacity of the deque - 1
+    size_t _offset; // the slot is _offset & _mask
+};
+
 #endif // !DEQUE_H
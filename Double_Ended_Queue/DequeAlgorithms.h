@@ -0,0 +1,147 @@
+#ifndef DEQUEALGORITHMS_H
+#define DEQUEALGORITHMS_H
+
+#include <bit>
+#include <span>
+#include <numeric>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "Deque.h"
+
+// segment-wise algorithms over ranges of the ring Deque
+//
+// A range of a ring is at most two contiguous regions: up to the end of the allocation and on from its
+// start. These overloads of copy, fill, find and accumulate take the regions from _segments() and run
+// each one as a plain pointer range, so the work goes to memmove (std::copy of a trivially copyable
+// type) or to a loop the compiler can vectorize instead of stepping and masking the iterator per element.
+// find compares 16 bytes at a time with SSE2 for integral element types.
+// Called unqualified on Deque iterators they are picked over the std:: algorithms as more specialized.
+
+template<typename _Iter>
+inline constexpr bool _isDequeIterator = false;
+
+template<typename _Type, bool _IsConst, IteratorPolicy _Policy, typename _Alloc>
+inline constexpr bool _isDequeIterator<_DequeIterator<_Type, _IsConst, _Policy, _Alloc>> = true;
+
+// std::find over one contiguous region
+template<typename _Type>
+const _Type* _findContiguous(const _Type* first, const _Type* last, const _Type& value) {
+#ifdef __SSE2__
+    if constexpr (std::is_integral_v<_Type> && (sizeof(_Type) == 1 || sizeof(_Type) == 2 || sizeof(_Type) == 4 || sizeof(_Type) == 8)) {
+        constexpr size_t lanes = 16 / sizeof(_Type);
+
+        __m128i needle;
+        if constexpr (sizeof(_Type) == 1) {
+            needle = _mm_set1_epi8(static_cast<char>(value));
+        } else if constexpr (sizeof(_Type) == 2) {
+            needle = _mm_set1_epi16(static_cast<short>(value));
+        } else if constexpr (sizeof(_Type) == 4) {
+            needle = _mm_set1_epi32(static_cast<int>(value));
+        } else {
+            needle = _mm_set1_epi64x(static_cast<long long>(value));
+        }
+
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+            __m128i equal;
+            if constexpr (sizeof(_Type) == 1) {
+                equal = _mm_cmpeq_epi8(block, needle);
+            } else if constexpr (sizeof(_Type) == 2) {
+                equal = _mm_cmpeq_epi16(block, needle);
+            } else if constexpr (sizeof(_Type) == 4) {
+                equal = _mm_cmpeq_epi32(block, needle);
+            } else {
+                // SSE2 has no 64 bit compare: a lane is equal if both of its 32 bit halves are
+                const __m128i halves = _mm_cmpeq_epi32(block, needle);
+                equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            // every byte of an equal lane is set in the mask
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal));
+            if (mask != 0) {
+                return first + std::countr_zero(mask) / sizeof(_Type);
+            }
+        }
+    }
+#endif
+
+    return std::find(first, last, value);
+}
+
+// copy into a Deque from anything random access, over the at most two regions the target range spans
+template<std::random_access_iterator _InIt, typename _Type, IteratorPolicy _Policy, typename _Alloc>
+    requires (!_isDequeIterator<_InIt>)
+_DequeIterator<_Type, false, _Policy, _Alloc> copy(_InIt first, _InIt last, _DequeIterator<_Type, false, _Policy, _Alloc> out) {
+    const auto count = last - first;
+    const auto target = out._segments(out + count);
+
+    const _InIt middle = first + static_cast<std::ptrdiff_t>(target.first.size());
+    std::copy(first, middle, target.first.data());
+    std::copy(middle, last, target.second.data());
+
+    return out + count;
+}
+
+// copy out of a Deque, into a Deque too
+template<typename _Type, bool _IsConst, IteratorPolicy _Policy, typename _Alloc, typename _OutIt>
+_OutIt copy(_DequeIterator<_Type, _IsConst, _Policy, _Alloc> first, _DequeIterator<_Type, _IsConst, _Policy, _Alloc> last, _OutIt out) {
+    const auto source = first._segments(last);
+
+    for (const auto& region : { std::span<const _Type>(source.first), std::span<const _Type>(source.second) }) {
+        if constexpr (_isDequeIterator<_OutIt>) {
+            out = ::copy(region.data(), region.data() + region.size(), out);
+        } else {
+            out = std::copy(region.data(), region.data() + region.size(), out);
+        }
+    }
+
+    return out;
+}
+
+template<typename _Type, IteratorPolicy _Policy, typename _Alloc>
+void fill(_DequeIterator<_Type, false, _Policy, _Alloc> first, _DequeIterator<_Type, false, _Policy, _Alloc> last,
+          const std::type_identity_t<_Type>& value) {
+    const auto target = first._segments(last);
+
+    std::fill(target.first.data(), target.first.data() + target.first.size(), value);
+    std::fill(target.second.data(), target.second.data() + target.second.size(), value);
+}
+
+template<typename _Type, bool _IsConst, IteratorPolicy _Policy, typename _Alloc>
+_DequeIterator<_Type, _IsConst, _Policy, _Alloc> find(_DequeIterator<_Type, _IsConst, _Policy, _Alloc> first, _DequeIterator<_Type, _IsConst, _Policy, _Alloc> last,
+                                              const std::type_identity_t<_Type>& value) {
+    const auto source = first._segments(last);
+
+    const _Type* const firstEnd = source.first.data() + source.first.size();
+    const _Type* found = _findContiguous<_Type>(source.first.data(), firstEnd, value);
+    if (found != firstEnd) {
+        return first + (found - source.first.data());
+    }
+
+    const _Type* const secondEnd = source.second.data() + source.second.size();
+    found = _findContiguous<_Type>(source.second.data(), secondEnd, value);
+    if (found != secondEnd) {
+        return first + static_cast<std::ptrdiff_t>(source.first.size() + (found - source.second.data()));
+    }
+
+    return last;
+}
+
+template<typename _Type, bool _IsConst, IteratorPolicy _Policy, typename _Alloc, typename _Acc, typename _BinaryOp = std::plus<>>
+_Acc accumulate(_DequeIterator<_Type, _IsConst, _Policy, _Alloc> first, _DequeIterator<_Type, _IsConst, _Policy, _Alloc> last, _Acc init,
+                _BinaryOp op = _BinaryOp()) {
+    const auto source = first._segments(last);
+
+    init = std::accumulate(source.first.data(), source.first.data() + source.first.size(), std::move(init), op);
+    return std::accumulate(source.second.data(), source.second.data() + source.second.size(), std::move(init), op);
+}
+
+#endif // !DEQUEALGORITHMS_H
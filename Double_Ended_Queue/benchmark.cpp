@@ -0,0 +1,496 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "Deque.h"
+#include "DequeAlgorithms.h"
+#include "../Utility/Benchmark.h"
+
+// the scans and the middle operations measure the iterators a release build would opt in to
+template<typename _Type>
+using UncheckedDeque = Deque<_Type, IteratorPolicy::Unchecked>;
+
+void printRow(const char* name, size_t depth, double nanoseconds) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::setw(8) << depth << " deep"
+              << std::setw(10) << std::fixed << std::setprecision(2) << nanoseconds << " ns/op" << std::endl;
+}
+
+constexpr size_t OPERATIONS = 1 << 22;
+
+// steady-state FIFO: the deque is held at depth elements, every operation pushes one and pops one,
+// so both ends keep wrapping around the ring
+double fifoChurn(size_t depth) {
+    Deque<uint64_t> deque;
+    for (size_t i = 0; i < depth; i++) {
+        deque.push_back(i);
+    }
+
+    uint64_t value = depth;
+    uint64_t checksum = 0;
+    const double ns = measureNs(OPERATIONS, [&] {
+        deque.push_back(value++);
+        checksum += deque.front();
+        deque.pop_front();
+    });
+    doNotOptimize(checksum);
+
+    return ns;
+}
+
+// random reads through operator[] of a deque whose contents wrap around the end of the ring,
+// depth is a power of two so picking the index costs a mask and not a division
+double randomAccess(size_t depth) {
+    Deque<uint64_t> deque;
+    for (size_t i = 0; i < depth; i++) {
+        deque.push_back(i);
+    }
+    for (size_t i = 0; i < depth / 2; i++) {
+        deque.pop_front();
+        deque.push_back(depth + i);
+    }
+
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    uint64_t checksum = 0;
+    const double ns = measureNs(OPERATIONS, [&] {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        checksum += deque[seed & (depth - 1)];
+    });
+    doNotOptimize(checksum);
+
+    return ns;
+}
+
+constexpr size_t TRAVERSAL_VISITS = size_t(1) << 27;
+
+template<typename _Type>
+_Type makeValue(size_t i) {
+    if constexpr (std::is_same_v<_Type, std::string>) {
+        return std::to_string(i);
+    } else {
+        return static_cast<_Type>(i);
+    }
+}
+
+// a deque of depth elements whose contents wrap around the end of the ring
+template<typename _Type, IteratorPolicy _Policy = IteratorPolicy::Unchecked>
+Deque<_Type, _Policy> wrappedRing(size_t depth) {
+    Deque<_Type, _Policy> deque;
+    for (size_t i = 0; i < depth; i++) {
+        deque.push_back(makeValue<_Type>(i));
+    }
+    for (size_t i = 0; i < depth / 2; i++) {
+        deque.pop_front();
+        deque.push_back(makeValue<_Type>(depth + i));
+    }
+
+    return deque;
+}
+
+// whole passes over the ring with func, the result is in ns per element visited
+template<typename _Deque, typename _Func>
+double traverse(_Deque& deque, _Func func) {
+    const size_t passes = std::max<size_t>(1, TRAVERSAL_VISITS / deque.size());
+    return measureNs(passes, [&] {
+        doNotOptimize(func(deque));
+    }) / deque.size();
+}
+
+template<IteratorPolicy _Policy>
+double rangeForSum(size_t depth) {
+    Deque<uint64_t, _Policy> deque = wrappedRing<uint64_t, _Policy>(depth);
+    return traverse(deque, [](Deque<uint64_t, _Policy>& deque) {
+        uint64_t sum = 0;
+        for (uint64_t value : deque) {
+            sum += value;
+        }
+        return sum;
+    });
+}
+
+// the elements are size_t-sized, so a checked iterator must assume a store through it may have changed
+// the deque it points to, and reload the deque on every step
+template<IteratorPolicy _Policy>
+double rangeForIncrement(size_t depth) {
+    Deque<uint64_t, _Policy> deque = wrappedRing<uint64_t, _Policy>(depth);
+    return traverse(deque, [](Deque<uint64_t, _Policy>& deque) {
+        for (uint64_t& value : deque) {
+            value++;
+        }
+        return deque.front();
+    });
+}
+
+// std::find of a value that is not there, so every element is compared
+template<IteratorPolicy _Policy>
+double findMissing(size_t depth) {
+    Deque<uint64_t, _Policy> deque = wrappedRing<uint64_t, _Policy>(depth);
+    return traverse(deque, [](Deque<uint64_t, _Policy>& deque) {
+        return std::find(deque.begin(), deque.end(), UINT64_MAX) - deque.begin();
+    });
+}
+
+// the lower bound: a plain loop over each of the two regions of the ring
+double spansSum(size_t depth) {
+    UncheckedDeque<uint64_t> deque = wrappedRing<uint64_t>(depth);
+    return traverse(deque, [](UncheckedDeque<uint64_t>& deque) {
+        const auto spans = std::as_const(deque).as_spans();
+        const uint64_t sum = std::accumulate(spans.first.begin(), spans.first.end(), uint64_t(0));
+        return std::accumulate(spans.second.begin(), spans.second.end(), sum);
+    });
+}
+
+// the middle operations are cut to about this many elements shifted per depth
+constexpr size_t MIDDLE_SHIFTS = size_t(1) << 28;
+
+// insert() and erase() in the middle of a deque held at depth elements, each shifts about half of them
+template<typename _Type>
+double middleInsertErase(size_t depth) {
+    UncheckedDeque<_Type> deque = wrappedRing<_Type>(depth);
+    const _Type value = makeValue<_Type>(7);
+
+    return measureNs(std::max<size_t>(16, MIDDLE_SHIFTS / depth), [&] {
+        deque.insert(deque.cbegin() + static_cast<std::ptrdiff_t>(depth / 2), value);
+        deque.erase(deque.cbegin() + static_cast<std::ptrdiff_t>(depth / 3));
+    }) / 2;
+}
+
+// a scan of the whole wrapped ring through the std:: algorithm on Deque iterators and through the
+// segment-wise overload of DequeAlgorithms.h, in ns per element
+template<typename _Scan>
+void printScan(const char* name, size_t depth, _Scan scan) {
+    UncheckedDeque<uint32_t> deque = wrappedRing<uint32_t>(depth);
+    std::vector<uint32_t> target(depth);
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::setw(10) << depth << std::fixed << std::setprecision(3)
+              << std::setw(14) << traverse(deque, [&](UncheckedDeque<uint32_t>& deque) { return scan(deque, target, std::false_type()); })
+              << std::setw(14) << traverse(deque, [&](UncheckedDeque<uint32_t>& deque) { return scan(deque, target, std::true_type()); })
+              << std::endl;
+}
+
+void fullScans(size_t depth) {
+    printScan("accumulate", depth, [](UncheckedDeque<uint32_t>& deque, std::vector<uint32_t>&, auto segmented) {
+        if constexpr (segmented) {
+            return ::accumulate(deque.cbegin(), deque.cend(), uint64_t(0));
+        } else {
+            return std::accumulate(deque.cbegin(), deque.cend(), uint64_t(0));
+        }
+    });
+    printScan("find, missing value", depth, [](UncheckedDeque<uint32_t>& deque, std::vector<uint32_t>&, auto segmented) {
+        if constexpr (segmented) {
+            return ::find(deque.cbegin(), deque.cend(), UINT32_MAX) - deque.cbegin();
+        } else {
+            return std::find(deque.cbegin(), deque.cend(), UINT32_MAX) - deque.cbegin();
+        }
+    });
+    printScan("fill", depth, [](UncheckedDeque<uint32_t>& deque, std::vector<uint32_t>&, auto segmented) {
+        if constexpr (segmented) {
+            ::fill(deque.begin(), deque.end(), 7);
+        } else {
+            std::fill(deque.begin(), deque.end(), 7);
+        }
+        return deque.back();
+    });
+    printScan("copy to a vector", depth, [](UncheckedDeque<uint32_t>& deque, std::vector<uint32_t>& target, auto segmented) {
+        if constexpr (segmented) {
+            ::copy(deque.cbegin(), deque.cend(), target.begin());
+        } else {
+            std::copy(deque.cbegin(), deque.cend(), target.begin());
+        }
+        return target.back();
+    });
+}
+
+constexpr size_t HEAVY_PUSHES = 1 << 16;
+constexpr size_t HEAVY_ROUNDS = 16;
+
+// an element whose every constructor fills a 256 byte payload, and that counts the constructors run
+struct Heavy {
+    static inline size_t constructions = 0;
+
+    uint64_t payload[32];
+
+    Heavy() : Heavy(0) {}
+
+    explicit Heavy(uint64_t seed) {
+        for (size_t i = 0; i < 32; i++) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            payload[i] = seed;
+        }
+        constructions++;
+    }
+
+    Heavy(const Heavy& other) {
+        std::copy(other.payload, other.payload + 32, payload);
+        constructions++;
+    }
+
+    Heavy(Heavy&& other) noexcept {
+        std::copy(other.payload, other.payload + 32, payload);
+        constructions++;
+    }
+
+    Heavy& operator=(const Heavy& right) = default;
+    Heavy& operator=(Heavy&& right) = default;
+};
+
+struct HeavyStats {
+    double nsPerPush;
+    double constructionsPerPush;
+};
+
+// grows a deque from empty to HEAVY_PUSHES elements, HEAVY_ROUNDS times
+HeavyStats heavyGrowth() {
+    Heavy::constructions = 0;
+
+    const double ns = measureNs(HEAVY_ROUNDS, [] {
+        Deque<Heavy> deque;
+        for (size_t i = 0; i < HEAVY_PUSHES; i++) {
+            deque.emplace_back(i);
+        }
+        doNotOptimize(deque.back().payload[0]);
+    });
+
+    const double pushes = double(HEAVY_ROUNDS) * HEAVY_PUSHES;
+
+    return { ns * HEAVY_ROUNDS / pushes, Heavy::constructions / pushes };
+}
+
+constexpr size_t STREAM = 1 << 23;
+constexpr size_t WINDOW = 4096;
+constexpr size_t BATCH = 1024;
+
+struct StreamStats {
+    size_t ringBytes; // memory of the ring once the stream ended
+    double p50; // ns per push over a batch
+    double p999;
+    double max;
+};
+
+// pushes STREAM samples in batches of BATCH and times every batch. The growing deque keeps the whole
+// stream, the trimmed one pops its front whenever it holds more than WINDOW samples, the bounded one
+// is constructed with overwrite_oldest and WINDOW
+template<typename _Push>
+StreamStats stream(Deque<uint64_t>& deque, _Push&& push) {
+    std::vector<double> batches;
+    batches.reserve(STREAM / BATCH);
+
+    uint64_t value = 0;
+    for (size_t batch = 0; batch < STREAM / BATCH; batch++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < BATCH; i++) {
+            push(value++);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        batches.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / BATCH);
+    }
+    doNotOptimize(deque.back());
+
+    std::sort(batches.begin(), batches.end());
+
+    // the ring has a power-of-two count of slots, one more than the capacity() of a growing deque
+    return { std::bit_ceil(deque.capacity() + 1) * sizeof(uint64_t), batches[batches.size() / 2],
+             batches[batches.size() * 999 / 1000], batches.back() };
+}
+
+void printStream(const char* name, const StreamStats& stats) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << stats.ringBytes / 1024 << " KiB"
+              << std::fixed << std::setprecision(2) << std::setw(10) << stats.p50 << std::setw(10) << stats.p999
+              << std::setw(10) << stats.max << std::endl;
+}
+
+constexpr size_t PIPE_BYTES = size_t(1) << 30;
+constexpr size_t PIPE_CHUNK = 64 * 1024;
+constexpr size_t RING_BYTES = 1 << 20;
+
+// fills iov with the non-empty spans of a span pair, returns how many it used
+template<typename _SpanPair>
+int toIovec(const _SpanPair& spans, iovec* iov) {
+    int count = 0;
+    if (!spans.first.empty()) {
+        iov[count++] = { (void*)spans.first.data(), spans.first.size() };
+    }
+    if (!spans.second.empty()) {
+        iov[count++] = { (void*)spans.second.data(), spans.second.size() };
+    }
+
+    return count;
+}
+
+// the sender keeps a full ring and streams it into the pipe, the receiver reads into its own ring and
+// drains it. Both refill or drain their ring with commit()/consume(), so the modes differ only in how
+// the bytes get between the ring and the pipe; returns GB/s
+double pipeThroughput(bool zeroCopy) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return 0.0;
+    }
+#ifdef F_SETPIPE_SZ
+    fcntl(fds[1], F_SETPIPE_SZ, int(RING_BYTES));
+#endif
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread sender([&] {
+        UncheckedDeque<char> out;
+        out.writable_spans(RING_BYTES - 1);
+        out.commit(RING_BYTES - 1);
+        char buffer[PIPE_CHUNK];
+
+        for (size_t sent = 0; sent < PIPE_BYTES;) {
+            ssize_t written = 0;
+            if (zeroCopy) {
+                iovec iov[2];
+                const UncheckedDeque<char>& ring = out;
+                written = writev(fds[1], iov, toIovec(ring.as_spans(), iov));
+            } else {
+                const size_t count = std::min(out.size(), PIPE_CHUNK);
+                std::copy_n(out.cbegin(), count, buffer);
+                written = write(fds[1], buffer, count);
+            }
+            if (written <= 0) {
+                break;
+            }
+
+            sent += size_t(written);
+            out.consume(size_t(written));
+            out.commit(size_t(written));
+        }
+        close(fds[1]);
+    });
+
+    Deque<char> in;
+    in.reserve(RING_BYTES - 1);
+    char buffer[PIPE_CHUNK];
+    uint64_t checksum = 0;
+
+    while (true) {
+        ssize_t received = 0;
+        if (zeroCopy) {
+            iovec iov[2];
+            received = readv(fds[0], iov, toIovec(in.writable_spans(PIPE_CHUNK), iov));
+            if (received > 0) {
+                in.commit(size_t(received));
+            }
+        } else {
+            received = read(fds[0], buffer, PIPE_CHUNK);
+            for (ssize_t i = 0; i < received; i++) {
+                in.push_back(buffer[i]);
+            }
+        }
+        if (received <= 0) {
+            break;
+        }
+
+        checksum += uint8_t(in.back());
+        in.consume(in.size());
+    }
+
+    sender.join();
+    close(fds[0]);
+    doNotOptimize(checksum);
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    return PIPE_BYTES / std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+int main() {
+    std::cout << "PUSH_BACK/POP_FRONT CHURN (" << OPERATIONS << " operations)\n" << std::endl;
+
+    for (size_t depth : { 1, 8, 64, 1024, 65536 }) {
+        printRow("ring Deque FIFO push/pop", depth, fifoChurn(depth));
+    }
+
+    std::cout << "\nRANDOM operator[] ON A WRAPPED RING (" << OPERATIONS << " reads)\n" << std::endl;
+
+    for (size_t depth : { 64, 1024, 65536, 1 << 20 }) {
+        printRow("ring Deque random operator[]", depth, randomAccess(depth));
+    }
+
+    std::cout << "\nTRAVERSAL OF A WRAPPED RING (ns per element, " << TRAVERSAL_VISITS << " visits)\n" << std::endl;
+
+    for (size_t depth : { 64, 4096, 65536, 1 << 20 }) {
+        printRow("Checked range-for sum", depth, rangeForSum<IteratorPolicy::Checked>(depth));
+        printRow("Unchecked range-for sum", depth, rangeForSum<IteratorPolicy::Unchecked>(depth));
+        printRow("Checked range-for increment", depth, rangeForIncrement<IteratorPolicy::Checked>(depth));
+        printRow("Unchecked range-for increment", depth, rangeForIncrement<IteratorPolicy::Unchecked>(depth));
+        printRow("Checked std::find, missing value", depth, findMissing<IteratorPolicy::Checked>(depth));
+        printRow("Unchecked std::find, missing value", depth, findMissing<IteratorPolicy::Unchecked>(depth));
+        printRow("as_spans() sum", depth, spansSum(depth));
+    }
+
+    std::cout << "\nMIDDLE insert() AND erase() ON A WRAPPED RING\n" << std::endl;
+
+    for (size_t depth : { 64, 1024, 16384, 262144 }) {
+        printRow("ring Deque<uint32_t> middle insert/erase", depth, middleInsertErase<uint32_t>(depth));
+        printRow("ring Deque<std::string> middle insert/erase", depth, middleInsertErase<std::string>(depth));
+    }
+
+    std::cout << "\nFULL SCAN OF A WRAPPED RING OF uint32_t (ns per element)\n" << std::endl;
+    std::cout << std::left << std::setw(20) << "" << std::right << std::setw(10) << "depth" << std::setw(14) << "std::"
+              << std::setw(14) << "segment-wise" << std::endl;
+
+    for (size_t depth : { 4096, 65536, 1 << 20 }) {
+        fullScans(depth);
+    }
+
+    std::cout << "\nPIPE TRANSFER OF " << (PIPE_BYTES >> 20) << " MiB BETWEEN TWO RINGS (" << PIPE_CHUNK / 1024
+              << " KiB chunks)\n" << std::endl;
+
+    std::cout << std::left << std::setw(44) << "copy through iterators + read/write" << std::right << std::fixed
+              << std::setprecision(2) << std::setw(8) << pipeThroughput(false) << " GB/s" << std::endl;
+    std::cout << std::left << std::setw(44) << "as_spans/writable_spans + readv/writev" << std::right
+              << std::setw(8) << pipeThroughput(true) << " GB/s" << std::endl;
+
+
+    std::cout << "\nGROWING FROM EMPTY TO " << HEAVY_PUSHES << " ELEMENTS WITH A 256 BYTE CONSTRUCTOR (" << HEAVY_ROUNDS
+              << " rounds)\n" << std::endl;
+
+    const HeavyStats heavy = heavyGrowth();
+    std::cout << std::left << std::setw(36) << "ring Deque emplace_back(Heavy)" << std::right << std::fixed
+              << std::setprecision(2) << std::setw(10) << heavy.nsPerPush << " ns/push" << std::setw(10)
+              << heavy.constructionsPerPush << " constructors/push" << std::endl;
+
+    std::cout << "\nINFINITE STREAM OF " << STREAM << " SAMPLES, WINDOW OF " << WINDOW << " (ns per push over batches of "
+              << BATCH << ")\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "" << std::right << std::setw(14) << "ring memory" << std::setw(10) << "p50"
+              << std::setw(10) << "p99.9" << std::setw(10) << "max" << std::endl;
+
+    {
+        Deque<uint64_t> deque;
+        printStream("growing, keeps everything", stream(deque, [&deque](uint64_t value) {
+            deque.push_back(value);
+        }));
+    }
+    {
+        Deque<uint64_t> deque;
+        printStream("growing, pop_front() trim", stream(deque, [&deque](uint64_t value) {
+            deque.push_back(value);
+            if (deque.size() > WINDOW) {
+                deque.pop_front();
+            }
+        }));
+    }
+    {
+        Deque<uint64_t> deque(overwrite_oldest, WINDOW);
+        printStream("overwrite_oldest", stream(deque, [&deque](uint64_t value) {
+            deque.push_back(value);
+        }));
+        std::cout << "overwrite_oldest evicted() = " << deque.evicted() << std::endl;
+    }
+
+    return 0;
+}
@@ -1,9 +1,12 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <string>
 #include <deque>
 
 #include "Deque.h"
+#include "DequeAlgorithms.h"
+#include "../Stack_Arena/StackArena.h"
 
 struct Point3D {
     Point3D() : _x(0.0f), _y(0.0f), _z(0.0f) {
@@ -74,6 +77,18 @@ std::ostream& operator<<(std::ostream& out, const Point3D& point3d) {
     return out << "x=" << point3d._x << ", "  << "y=" << point3d._y << ", " << "z=" << point3d._z;
 }
 
+// has no default constructor and counts the live objects, the deque must construct and destroy each exactly once
+struct Ticket {
+    static inline int alive = 0;
+
+    explicit Ticket(int number) : _number(number) { alive++; }
+    Ticket(const Ticket& source) : _number(source._number) { alive++; }
+    Ticket& operator=(const Ticket& right) = default;
+    ~Ticket() { alive--; }
+
+    int _number;
+};
+
 template<typename T>
 void writeDeque(const Deque<T>& deq, std::ofstream& tFile) {
     tFile << "\nDeque::size() = " << deq.size() << "\n" << std::endl;
@@ -263,10 +278,10 @@ int main() {
         Deque<Point3D>::reverse_iterator rend = deq.rend();
 
         myDequeTestFile << "\nDeque element at begin() pos: " << *beg << std::endl;
-        myDequeTestFile << "Deque element at end() pos: " << *end << std::endl;
+        myDequeTestFile << "Deque element before end() pos: " << *(end - 1) << std::endl;
 
         myDequeTestFile << "Deque element at rbegin() pos: " << *rbeg << std::endl;
-        myDequeTestFile << "Deque element at rend() pos: " << *rend << std::endl;
+        myDequeTestFile << "Deque element before rend() pos: " << *std::prev(rend) << std::endl;
 
         myDequeTestFile << "\nPrinting Deque elements from begin() to end() ...\n" << std::endl;
         for (; beg != end; beg++) {
@@ -284,10 +299,10 @@ int main() {
         Deque<Point3D>::const_reverse_iterator crend = deq.crend();
 
         myDequeTestFile << "\nDeque element at cbegin() pos: " << *cbeg << std::endl;
-        myDequeTestFile << "Deque element at cend() pos: " << *cend << std::endl;
+        myDequeTestFile << "Deque element before cend() pos: " << *(cend - 1) << std::endl;
 
         myDequeTestFile << "Deque element at crbegin() pos: " << *crbeg << std::endl;
-        myDequeTestFile << "Deque element at crend() pos: " << *crend << std::endl;
+        myDequeTestFile << "Deque element before crend() pos: " << *std::prev(crend) << std::endl;
 
         myDequeTestFile << "\nPrinting Deque elements from cbegin() to cend() ...\n" << std::endl;
         for (; cbeg != cend; cbeg++) {
@@ -506,6 +521,258 @@ int main() {
         writeDeque(deq2, myDequeTestFile);
     }
 
+    myDequeTestFile << "\n\nDEQUE CONTIGUOUS SPANS\n" << std::endl;
+
+    {
+        Deque<int> deq;
+        for (int i = 0; i < 12; i++) {
+            deq.push_back(i);
+        }
+        deq.consume(10);
+
+        myDequeTestFile << "Push 0 to 11, consume(10), size() = " << deq.size() << ", capacity() = " << deq.capacity() << std::endl;
+
+        auto writable = deq.writable_spans(8);
+        int value = 100;
+        for (int& slot : writable.first) {
+            slot = value++;
+        }
+        for (int& slot : writable.second) {
+            slot = value++;
+        }
+        deq.commit(8);
+
+        myDequeTestFile << "writable_spans(8) has regions of " << writable.first.size() << " and " << writable.second.size()
+                        << " slots, after filling them with 100 to 107 and commit(8) size() = " << deq.size() << std::endl;
+
+        auto spans = deq.as_spans();
+        myDequeTestFile << "as_spans() first region:";
+        for (int element : spans.first) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << "\nas_spans() second region:";
+        for (int element : spans.second) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        deq.consume(deq.size());
+        myDequeTestFile << "consume(size()), empty() = " << std::boolalpha << deq.empty()
+                        << ", as_spans() holds " << deq.as_spans().first.size() + deq.as_spans().second.size() << " elements" << std::endl;
+    }
+
+    myDequeTestFile << "\n\nDEQUE OVERWRITE OLDEST\n" << std::endl;
+
+    {
+        Deque<int> window(overwrite_oldest, 5);
+
+        myDequeTestFile << "Deque<int>(overwrite_oldest, 5), bounded() = " << window.bounded()
+                        << ", capacity() = " << window.capacity() << std::endl;
+
+        for (int i = 0; i < 12; i++) {
+            window.push_back(i);
+        }
+        myDequeTestFile << "Push 0 to 11, size() = " << window.size() << ", evicted() = " << window.evicted() << ", contents:";
+        for (int element : window) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        window.push_front(-1);
+        myDequeTestFile << "push_front(-1) drops the back, evicted() = " << window.evicted() << ", contents:";
+        for (int element : window) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        window.insert(window.cbegin() + 2, 100);
+        myDequeTestFile << "insert(cbegin() + 2, 100) drops the front, evicted() = " << window.evicted() << ", contents:";
+        for (int element : window) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        window.insert(window.cbegin(), -2);
+        myDequeTestFile << "insert(cbegin(), -2) drops the back like push_front(), evicted() = " << window.evicted() << ", contents:";
+        for (int element : window) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        window.insert(window.cbegin(), 2, window.back());
+        myDequeTestFile << "insert(cbegin(), 2, back()) drops the back too, evicted() = " << window.evicted() << ", contents:";
+        for (int element : window) {
+            myDequeTestFile << " " << element;
+        }
+        myDequeTestFile << std::endl;
+
+        window.reserve(100);
+        myDequeTestFile << "reserve(100) keeps the bound, capacity() = " << window.capacity()
+                        << ", writable_spans(10) has " << window.writable_spans(10).first.size() + window.writable_spans(10).second.size()
+                        << " slots" << std::endl;
+    }
+
+    myDequeTestFile << "\n\nDEQUE OF A TYPE WITHOUT DEFAULT CONSTRUCTOR\n" << std::endl;
+
+    {
+        Deque<Ticket> tickets;
+        myDequeTestFile << "Empty Deque<Ticket>, capacity() = " << tickets.capacity() << ", alive tickets = " << Ticket::alive << std::endl;
+
+        for (int i = 0; i < 40; i++) {
+            tickets.emplace_back(i);
+        }
+        myDequeTestFile << "emplace_back() 40 tickets through two reallocations, alive tickets = " << Ticket::alive << std::endl;
+
+        tickets.erase(tickets.cbegin() + 10, tickets.cbegin() + 30);
+        tickets.pop_front();
+        tickets.insert(tickets.cbegin() + 5, 3, Ticket(-1));
+        myDequeTestFile << "erase() 20, pop_front(), insert() 3, size() = " << tickets.size() << ", alive tickets = " << Ticket::alive
+                        << ", contents:";
+        for (const Ticket& ticket : tickets) {
+            myDequeTestFile << " " << ticket._number;
+        }
+        myDequeTestFile << std::endl;
+
+        tickets.clear();
+        myDequeTestFile << "clear(), alive tickets = " << Ticket::alive << std::endl;
+    }
+
+    myDequeTestFile << "\n\nDEQUE ERASE OF AN EMPTY RANGE\n" << std::endl;
+
+    {
+        Deque<std::string> words = { "alpha", "bravo", "charlie" };
+
+        auto next = words.erase(words.cbegin() + 1, words.cbegin() + 1);
+        myDequeTestFile << "erase(cbegin() + 1, cbegin() + 1) leaves the elements alone, *result = " << *next << ", contents:";
+        for (const std::string& word : words) {
+            myDequeTestFile << " " << word;
+        }
+        myDequeTestFile << std::endl;
+
+        words.erase(words.cend(), words.cend());
+        words.erase(words.cbegin(), words.cbegin());
+        myDequeTestFile << "erase(cend(), cend()) and erase(cbegin(), cbegin()), size() = " << words.size() << ", contents:";
+        for (const std::string& word : words) {
+            myDequeTestFile << " " << word;
+        }
+        myDequeTestFile << std::endl;
+    }
+
+    myDequeTestFile << "\n\nDEQUE ITERATOR POLICIES\n" << std::endl;
+
+    {
+        Deque<int, IteratorPolicy::Checked> checked;
+        Deque<int, IteratorPolicy::Unchecked> unchecked;
+        // both rings wrap around their end
+        for (int i = 0; i < 12; i++) {
+            checked.push_back(i);
+            unchecked.push_back(i);
+        }
+        for (int i = 12; i < 20; i++) {
+            checked.pop_front();
+            checked.push_back(i);
+            unchecked.pop_front();
+            unchecked.push_back(i);
+        }
+
+        myDequeTestFile << "Unchecked range-for:";
+        for (int value : unchecked) {
+            myDequeTestFile << " " << value;
+        }
+        myDequeTestFile << std::endl;
+
+        const auto uncheckedIt = unchecked.cbegin() + 4;
+        const auto checkedIt = checked.cbegin() + 4;
+        myDequeTestFile << "(cbegin() + 4)[2] = " << uncheckedIt[2] << " unchecked, " << checkedIt[2] << " checked, cend() - (cbegin() + 4) = "
+                        << unchecked.cend() - uncheckedIt << std::endl;
+
+        try {
+            myDequeTestFile << checkedIt[8] << std::endl;
+        } catch (const std::out_of_range& e) {
+            myDequeTestFile << "Checked (cbegin() + 4)[8]: " << e.what() << std::endl;
+        }
+    }
+
+    myDequeTestFile << "\n\nDEQUE SEGMENT-WISE ALGORITHMS\n" << std::endl;
+
+    {
+        // 12 elements in a ring of 16 slots, the last 4 of them wrapped around to its start
+        Deque<int> ring;
+        for (int i = 0; i < 12; i++) {
+            ring.push_back(i);
+        }
+        for (int i = 12; i < 20; i++) {
+            ring.pop_front();
+            ring.push_back(i);
+        }
+        const auto segments = ring.cbegin()._segments(ring.cend());
+        myDequeTestFile << "Contents 8 to 19 lie in regions of " << segments.first.size() << " and " << segments.second.size()
+                        << " elements" << std::endl;
+
+        myDequeTestFile << "accumulate() = " << accumulate(ring.cbegin(), ring.cend(), 0)
+                        << ", find(13) - cbegin() = " << find(ring.cbegin(), ring.cend(), 13) - ring.cbegin()
+                        << ", find(99) == cend(): " << std::boolalpha << (find(ring.cbegin(), ring.cend(), 99) == ring.cend()) << std::endl;
+
+        fill(ring.begin() + 6, ring.begin() + 10, -1);
+        myDequeTestFile << "fill(begin() + 6, begin() + 10, -1):";
+        for (int value : ring) {
+            myDequeTestFile << " " << value;
+        }
+        myDequeTestFile << std::endl;
+
+        const int source[] = { 100, 101, 102, 103, 104, 105 };
+        copy(std::begin(source), std::end(source), ring.begin() + 5);
+        int target[12] = {};
+        copy(ring.cbegin(), ring.cend(), target);
+        myDequeTestFile << "copy() 6 values to begin() + 5, then the ring to an array:";
+        for (int value : target) {
+            myDequeTestFile << " " << value;
+        }
+        myDequeTestFile << std::endl;
+
+        ring.insert(ring.cbegin() + 6, 3, 0);
+        ring.erase(ring.cbegin() + 1, ring.cbegin() + 3);
+        myDequeTestFile << "insert(cbegin() + 6, 3, 0) and erase(cbegin() + 1, cbegin() + 3), both shifting with memmove:";
+        for (int value : ring) {
+            myDequeTestFile << " " << value;
+        }
+        myDequeTestFile << std::endl;
+    }
+
+    myDequeTestFile << "\n\nDEQUE WITH AN ARENA ALLOCATOR\n" << std::endl;
+
+    {
+        using ArenaDeque = Deque<std::string, IteratorPolicy::Checked, ArenaAllocator<std::string>>;
+
+        StackArena arena;
+        ArenaDeque words({ "alpha", "bravo", "charlie" }, arena);
+        for (int i = 0; i < 40; i++) {
+            words.push_back(std::to_string(i));
+        }
+        myDequeTestFile << "Deque({ alpha, bravo, charlie }, arena) and 40 push_back() through two reallocations, size() = " << words.size()
+                        << ", the slots come from the arena = " << (&words.get_allocator().arena() == &arena && arena.used() > 0) << std::endl;
+
+        ArenaDeque copy(words);
+        myDequeTestFile << "copy shares the arena = " << (copy.get_allocator() == words.get_allocator())
+                        << ", copy[2] = " << copy[2] << std::endl;
+
+        StackArena other;
+        ArenaDeque target(3, "x", other);
+        target = words;
+        myDequeTestFile << "copy assignment propagates the allocator, the target uses the first arena = "
+                        << (&target.get_allocator().arena() == &arena) << ", target.back() = " << target.back() << std::endl;
+
+        Deque<int, IteratorPolicy::Checked, ArenaAllocator<int>> window(overwrite_oldest, 4, ArenaAllocator<int>(arena));
+        for (int i = 0; i < 10; i++) {
+            window.push_back(i);
+        }
+        myDequeTestFile << "bounded Deque(overwrite_oldest, 4, arena) after pushing 0 to 9:";
+        for (int value : window) {
+            myDequeTestFile << " " << value;
+        }
+        myDequeTestFile << std::endl;
+    }
+
     myDequeTestFile.close();
 
     return 0;
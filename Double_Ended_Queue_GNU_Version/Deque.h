@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <memory>
+#include <iterator>
 #include <algorithm>
 #include <exception>
 
@@ -17,7 +18,7 @@ class _DequeIterator;
 // (map of nodes according to the gcc STL terminology). 
 // The map grows outwards in both directions and shinks inwards from both directions.
 
-template<typename _Type>
+template<typename _Type, typename _Alloc = std::allocator<_Type>>
 class Deque {
 public:
     using value_type = _Type;
@@ -27,6 +28,7 @@ public:
     using const_reference = const _Type&;
     using pointer = _Type*;
     using const_pointer = const _Type*;
+    using allocator_type = _Alloc;
 
     using iterator = _DequeIterator<_Type, _Type&, _Type*>;
     using const_iterator = _DequeIterator<_Type, const _Type&, const _Type*>;
@@ -39,6 +41,8 @@ public:
 public:
     // ctors
     Deque();
+
+    explicit Deque(const _Alloc& alloc);
     
     explicit Deque(size_t count);
 
@@ -112,6 +116,10 @@ public:
 
     void pop_back();
 
+    // copies [first, last) to the back, allocating all needed chunks up front
+    template<typename ForwardIt>
+    void append(ForwardIt first, ForwardIt last);
+
     void push_front(const _Type& value);
     void push_front(_Type&& velue);
 
@@ -125,7 +133,22 @@ public:
 
     void swap(Deque& other);
 
+    allocator_type get_allocator() const;
+
 private:
+    // chunks come from _Alloc itself, the map from _Alloc rebound to chunk pointers
+    using _AllocTraits = std::allocator_traits<_Alloc>;
+    using _MapAlloc = typename _AllocTraits::template rebind_alloc<_Elptr>;
+    using _MapAllocTraits = std::allocator_traits<_MapAlloc>;
+
+    _Elptr _allocate_chunk();
+
+    void _deallocate_chunk(_Elptr chunk);
+
+    _Mapptr _allocate_map_array(size_t map_size);
+
+    void _deallocate_map_array(_Mapptr map, size_t map_size);
+
     void _allocate_nodes(_Mapptr n_start, _Mapptr n_finish);
 
     _Mapptr _initialize_map(size_t num_els);
@@ -170,6 +193,7 @@ private:
     void _fill_insert(iterator where, size_t count, const _Type& value);
 
 private:
+    [[no_unique_address]] _Alloc _alloc; // storage comes from here, std::allocator by default
     _Mapptr _map; // array of pointers to arrays (map) of elements of type _Type 
     size_t _map_size; // the size of the map
     iterator _start; // the first node of the map (the first chunk/array of pointers) 
@@ -178,21 +202,46 @@ private:
 
 // Deque definition
 
-template<typename _Type>
-void Deque<_Type>::_allocate_nodes(_Mapptr n_start, _Mapptr n_finish) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::_Elptr Deque<_Type, _Alloc>::_allocate_chunk() {
+    return _AllocTraits::allocate(_alloc, CHUNK_SIZE);
+}
+
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_deallocate_chunk(_Elptr chunk) {
+    _AllocTraits::deallocate(_alloc, chunk, CHUNK_SIZE);
+}
+
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::_Mapptr Deque<_Type, _Alloc>::_allocate_map_array(size_t map_size) {
+    _MapAlloc mapAlloc(_alloc);
+    return _MapAllocTraits::allocate(mapAlloc, map_size);
+}
+
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_deallocate_map_array(_Mapptr map, size_t map_size) {
+    if (map == nullptr) {
+        return; // a moved-from deque owns no map
+    }
+    _MapAlloc mapAlloc(_alloc);
+    _MapAllocTraits::deallocate(mapAlloc, map, map_size);
+}
+
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_allocate_nodes(_Mapptr n_start, _Mapptr n_finish) {
     _Mapptr current_node = n_start;
     for (; current_node != n_finish; ++current_node) {
-        *current_node = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+        *current_node = _allocate_chunk();
     }
 }
 
-template<typename _Type>
-typename Deque<_Type>::_Mapptr Deque<_Type>::_initialize_map(size_t num_els) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::_Mapptr Deque<_Type, _Alloc>::_initialize_map(size_t num_els) {
     const size_t num_nodes = (num_els / CHUNK_SIZE) + 1;
     _map_size = std::max(DEFAULT_INIT_MAP_SIZE, num_nodes + 2);
 
     // allocate memory for the map
-    _map = static_cast<_Mapptr>(::operator new(_map_size * SIZE_MPTR_IN_BYTES)); 
+    _map = _allocate_map_array(_map_size); 
 
     _Mapptr node_start = _map + (_map_size - num_nodes) / 2;
     _Mapptr node_finish = node_start + num_nodes;
@@ -208,67 +257,67 @@ typename Deque<_Type>::_Mapptr Deque<_Type>::_initialize_map(size_t num_els) {
     return _map;
 }
 
-template<typename _Type>
-void Deque<_Type>::_fill_map(iterator first, iterator last, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_fill_map(iterator first, iterator last, const _Type& value) {
     for (; first != last; ++first) {
         ::new(static_cast<void*>(&*first)) _Type(value);
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename InputIt, typename ForwardIt>
-void Deque<_Type>::_copy_map(InputIt first, InputIt last, ForwardIt dest_first) {
+void Deque<_Type, _Alloc>::_copy_map(InputIt first, InputIt last, ForwardIt dest_first) {
     for (; first != last; ++first, ++dest_first) {
         ::new(static_cast<void*>(&*dest_first)) _Type(*first);
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::_destroy_elements(iterator first, iterator last) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_destroy_elements(iterator first, iterator last) {
     for (; first != last; ++first) {
         (*first).~_Type();
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::_deallocate_nodes(_Mapptr n_start, _Mapptr n_finish) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_deallocate_nodes(_Mapptr n_start, _Mapptr n_finish) {
     _Mapptr current_node = n_start;
     for (; current_node != n_finish; ++current_node) {
-        ::operator delete(*current_node, CHUNK_SIZE * sizeof(_Type));
+        _deallocate_chunk(*current_node);
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::_deallocate_map() {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_deallocate_map() {
     // deallocates memory for [_start, _finish node)
     _deallocate_nodes(_start._node, _finish._node);
 
     // deallocates memory for the last node
     if (_finish._node) 
-        ::operator delete(*_finish._node, CHUNK_SIZE * sizeof(_Type));
+        _deallocate_chunk(*_finish._node);
     
     // deallocates the map
-    ::operator delete(_map, DEFAULT_INIT_MAP_SIZE);
+    _deallocate_map_array(_map, _map_size);
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename InputIt, typename OutputIt>
-void Deque<_Type>::_move(InputIt first, InputIt last, OutputIt dest_first) {
+void Deque<_Type, _Alloc>::_move(InputIt first, InputIt last, OutputIt dest_first) {
     while (first != last) {
         *dest_first++ = std::move(*first++);
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename BidirectIt1, typename BidirectIt2>
-void Deque<_Type>::_move_backwards(BidirectIt1 first, BidirectIt1 last, BidirectIt2 dest_last) {
+void Deque<_Type, _Alloc>::_move_backwards(BidirectIt1 first, BidirectIt1 last, BidirectIt2 dest_last) {
     while (first != last) {
         *(--dest_last) = std::move(*(--last));
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::_reallocate_map(size_t nodes_count, bool add_at_front) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_reallocate_map(size_t nodes_count, bool add_at_front) {
     const size_t old_num_nodes = _finish._node - _start._node + 1;
     const size_t new_num_nodes = old_num_nodes + nodes_count;
 
@@ -284,7 +333,7 @@ void Deque<_Type>::_reallocate_map(size_t nodes_count, bool add_at_front) {
         }
     } else {
         size_t new_map_size = _map_size + std::max(_map_size, nodes_count) + 2;
-        _Mapptr new_map = static_cast<_Mapptr>(::operator new(new_map_size * SIZE_MPTR_IN_BYTES));
+        _Mapptr new_map = _allocate_map_array(new_map_size);
         
         new_start_node = new_map + (new_map_size - new_num_nodes) / 2 + (add_at_front ? nodes_count : 0);
         
@@ -293,7 +342,7 @@ void Deque<_Type>::_reallocate_map(size_t nodes_count, bool add_at_front) {
 
         // deallocate only the _map!
         // the _start to _finish nodes are copied (the pointers) in the new_start_node
-        ::operator delete(_map, DEFAULT_INIT_MAP_SIZE);
+        _deallocate_map_array(_map, _map_size);
 
         _map = new_map;
         _map_size = new_map_size;
@@ -303,22 +352,22 @@ void Deque<_Type>::_reallocate_map(size_t nodes_count, bool add_at_front) {
     _finish._set_node(new_start_node + old_num_nodes - 1);
 }
 
-template<typename _Type>
-void Deque<_Type>::_reserve_map_at_front(size_t nodes_count) {
-    if (nodes_count > _start._node - _map) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_reserve_map_at_front(size_t nodes_count) {
+    if (nodes_count > size_t(_start._node - _map)) {
         _reallocate_map(nodes_count, true);
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::_reserve_map_at_back(size_t nodes_count) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_reserve_map_at_back(size_t nodes_count) {
     if (nodes_count + 1 > _map_size - (_finish._node - _map)) {
         _reallocate_map(nodes_count, false);
     }
 }
 
-template <typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::_reserve_elements_at_front(size_t count) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::_reserve_elements_at_front(size_t count) {
     const size_t vacancies = _start._curr - _start._first;
     
     if (count > vacancies) {
@@ -326,30 +375,31 @@ typename Deque<_Type>::iterator Deque<_Type>::_reserve_elements_at_front(size_t
         const size_t new_nodes_count = (new_elements + CHUNK_SIZE - 1) / CHUNK_SIZE;
         _reserve_map_at_front(new_nodes_count);
         for (size_t i = 1; i <= new_nodes_count; ++i)
-            *(_start._node - i) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+            *(_start._node - i) = _allocate_chunk();
     }
 
     return _start - ptrdiff_t(count);
 }
 
-template <typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::_reserve_elements_at_back(size_t count) {
-    const size_t vacancies = _finish._last - _finish._curr;
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::_reserve_elements_at_back(size_t count) {
+    // _finish must stay inside an allocated chunk, so the last slot of the chunk is not a vacancy
+    const size_t vacancies = _finish._last - _finish._curr - 1;
     
     if (count > vacancies) {
         const size_t new_elements = count - vacancies;
         const size_t new_nodes_count = (new_elements + CHUNK_SIZE - 1) / CHUNK_SIZE;
         _reserve_map_at_back(new_nodes_count);
         for (size_t i = 1; i <= new_nodes_count; ++i)
-            *(_finish._node + i) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+            *(_finish._node + i) = _allocate_chunk();
     }
 
     return _finish + ptrdiff_t(count);
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename InputIt, typename ForwardIt>
-ForwardIt Deque<_Type>::_uninit_move(InputIt first, InputIt last, ForwardIt dest_first) {
+ForwardIt Deque<_Type, _Alloc>::_uninit_move(InputIt first, InputIt last, ForwardIt dest_first) {
     ForwardIt curr_dest = dest_first;
     for (; first != last; ++first, ++curr_dest) {
         ::new(static_cast<void*>(&*curr_dest)) _Type(std::move(*first));
@@ -357,16 +407,16 @@ ForwardIt Deque<_Type>::_uninit_move(InputIt first, InputIt last, ForwardIt dest
     return curr_dest;
 }
 
-template<typename _Type>
-void Deque<_Type>::_uninit_fill(iterator first, iterator last, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_uninit_fill(iterator first, iterator last, const _Type& value) {
     for (; first != last; ++first) {
         ::new(static_cast<void*>(&*first)) _Type(value);
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-typename Deque<_Type>::iterator Deque<_Type>::_insert_helper(iterator where, Args&&... args) {
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::_insert_helper(iterator where, Args&&... args) {
     ptrdiff_t idx = where - _start;
 
     _Type val_cp(std::forward<Args>(args)...);
@@ -401,8 +451,8 @@ typename Deque<_Type>::iterator Deque<_Type>::_insert_helper(iterator where, Arg
     return where;
 }
 
-template<typename _Type>
-void Deque<_Type>::_insert_range_helper(iterator where, size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_insert_range_helper(iterator where, size_t count, const _Type& value) {
     const ptrdiff_t els_before = where - _start;
     const size_t size = this->size();
     _Type value_cp = value;
@@ -451,8 +501,8 @@ void Deque<_Type>::_insert_range_helper(iterator where, size_t count, const _Typ
     }
 }   
 
-template<typename _Type>
-void Deque<_Type>::_fill_insert(iterator where, size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::_fill_insert(iterator where, size_t count, const _Type& value) {
     if (where._curr == _start._curr) {
         iterator new_start = _reserve_elements_at_front(count);
         _fill_map(new_start, _start, value);
@@ -466,51 +516,59 @@ void Deque<_Type>::_fill_insert(iterator where, size_t count, const _Type& value
     }
 }
 
-template<typename _Type>
-Deque<_Type>::Deque() : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque() : _alloc(), _map(), _map_size(0), _start(), _finish() {
+    _initialize_map(0);
+}
+
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(const _Alloc& alloc) : _alloc(alloc), _map(), _map_size(0), _start(), _finish() {
     _initialize_map(0);
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(size_t count) : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(size_t count) : _alloc(), _map(), _map_size(0), _start(), _finish() {
     _initialize_map(count);
     _fill_map(_start, _finish, _Type());
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(size_t count, const _Type& value) : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(size_t count, const _Type& value) : _alloc(), _map(), _map_size(0), _start(), _finish() {
     _initialize_map(count);
     _fill_map(_start, _finish, value);
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(const Deque& source) : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(const Deque& source) :
+    _alloc(_AllocTraits::select_on_container_copy_construction(source._alloc)), _map(), _map_size(0), _start(), _finish() {
     _initialize_map(source.size());
     _copy_map(source.cbegin(), source.cend(), begin());
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(Deque&& source) : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(Deque&& source) : _alloc(source._alloc), _map(), _map_size(0), _start(), _finish() {
     swap(source);    
 }
 
-template<typename _Type>
-Deque<_Type>::Deque(std::initializer_list<_Type> ilist) : _map(), _map_size(0), _start(), _finish() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::Deque(std::initializer_list<_Type> ilist) : _alloc(), _map(), _map_size(0), _start(), _finish() {
     _initialize_map(0);
     for (auto it = ilist.begin(); it != ilist.end(); ++it) {
         emplace_back(*it);
     } 
 }
 
-template<typename _Type>
-Deque<_Type>::~Deque() {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>::~Deque() {
     clear();
+    _deallocate_map();
 }
 
-template<typename _Type>
-Deque<_Type>& Deque<_Type>::operator=(const Deque& right) {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>& Deque<_Type, _Alloc>::operator=(const Deque& right) {
     if (this != &right) {
         clear();
+        _deallocate_map();
         _initialize_map(right.size());
         _copy_map(right.cbegin(), right.cend(), begin());
     }
@@ -518,8 +576,8 @@ Deque<_Type>& Deque<_Type>::operator=(const Deque& right) {
     return *this;
 }
 
-template<typename _Type>
-Deque<_Type>& Deque<_Type>::operator=(Deque&& right) {
+template<typename _Type, typename _Alloc>
+Deque<_Type, _Alloc>& Deque<_Type, _Alloc>::operator=(Deque&& right) {
     if (this != &right) {
         _destroy_elements(begin(), end());
         swap(right);
@@ -530,115 +588,115 @@ Deque<_Type>& Deque<_Type>::operator=(Deque&& right) {
     return *this;
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::at(size_t pos) {
+template<typename _Type, typename _Alloc>
+_Type& Deque<_Type, _Alloc>::at(size_t pos) {
     if (pos > size()) 
         throw std::out_of_range("Deque Error: Index out of bounds!");
     
     return (*this)[pos];
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::at(size_t pos) const {
+template<typename _Type, typename _Alloc>
+const _Type& Deque<_Type, _Alloc>::at(size_t pos) const {
     if (pos > size()) 
         throw std::out_of_range("Deque Error: Index out of bounds!");
     
     return (*this)[pos];
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::operator[](size_t pos) {
+template<typename _Type, typename _Alloc>
+_Type& Deque<_Type, _Alloc>::operator[](size_t pos) {
     return _start[ptrdiff_t(pos)];
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::operator[](size_t pos) const {
+template<typename _Type, typename _Alloc>
+const _Type& Deque<_Type, _Alloc>::operator[](size_t pos) const {
     return _start[ptrdiff_t(pos)];
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::front() {
+template<typename _Type, typename _Alloc>
+_Type& Deque<_Type, _Alloc>::front() {
     return *begin();
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::front() const {
+template<typename _Type, typename _Alloc>
+const _Type& Deque<_Type, _Alloc>::front() const {
     return *begin();
 }
 
-template<typename _Type>
-_Type& Deque<_Type>::back() {
+template<typename _Type, typename _Alloc>
+_Type& Deque<_Type, _Alloc>::back() {
     iterator tmp = end();
     --tmp;
     return *tmp;
 }
 
-template<typename _Type>
-const _Type& Deque<_Type>::back() const {
+template<typename _Type, typename _Alloc>
+const _Type& Deque<_Type, _Alloc>::back() const {
     const_iterator tmp_back = end();
     --tmp_back;
     return *tmp_back;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::begin() {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::begin() {
     return _start;
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_iterator Deque<_Type>::cbegin() const {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::const_iterator Deque<_Type, _Alloc>::cbegin() const {
     return _start;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::end() {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::end() {
     return _finish;
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_iterator Deque<_Type>::cend() const {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::const_iterator Deque<_Type, _Alloc>::cend() const {
     return _finish;
 }
 
-template<typename _Type>
-typename Deque<_Type>::reverse_iterator Deque<_Type>::rbegin() {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::reverse_iterator Deque<_Type, _Alloc>::rbegin() {
     return reverse_iterator(_finish);
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_reverse_iterator Deque<_Type>::crbegin() const {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::const_reverse_iterator Deque<_Type, _Alloc>::crbegin() const {
     return const_reverse_iterator(_finish);
 }
 
-template<typename _Type>
-typename Deque<_Type>::reverse_iterator Deque<_Type>::rend() {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::reverse_iterator Deque<_Type, _Alloc>::rend() {
     return reverse_iterator(_start);
 }
 
-template<typename _Type>
-typename Deque<_Type>::const_reverse_iterator Deque<_Type>::crend() const {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::const_reverse_iterator Deque<_Type, _Alloc>::crend() const {
     return const_reverse_iterator(_start);
 }
 
-template<typename _Type>
-bool Deque<_Type>::empty() const {
+template<typename _Type, typename _Alloc>
+bool Deque<_Type, _Alloc>::empty() const {
     return _finish == _start;
 }
 
-template<typename _Type>
-size_t Deque<_Type>::size() const {
+template<typename _Type, typename _Alloc>
+size_t Deque<_Type, _Alloc>::size() const {
     return _finish == _start ? 0 : _finish - _start;
 }
 
-template<typename _Type>
-void Deque<_Type>::clear() {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::clear() {
     _destroy_elements(_start, _finish);
     _deallocate_nodes(_start._node + 1, _finish._node + 1);
     _finish = _start;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, const _Type& value) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::insert(const_iterator where, const _Type& value) {
     if (where._curr == _start._curr) {
         push_front(value);
         return _start;
@@ -652,21 +710,21 @@ typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, const
     return _insert_helper(where._const_cast(), value);
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, _Type&& value) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::insert(const_iterator where, _Type&& value) {
     return emplace(where, std::move(value));
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::insert(const_iterator where, size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::insert(const_iterator where, size_t count, const _Type& value) {
     ptrdiff_t offset = where - cbegin();
     _fill_insert(where._const_cast(), count, value);
     return begin() + offset;
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-typename Deque<_Type>::iterator Deque<_Type>::emplace(const_iterator where, Args&&... args) {
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::emplace(const_iterator where, Args&&... args) {
     if (where._curr == _start._curr) {
         emplace_front(std::forward<Args>(args)...);
         return _start;
@@ -680,8 +738,8 @@ typename Deque<_Type>::iterator Deque<_Type>::emplace(const_iterator where, Args
     return _insert_helper(where._const_cast(), std::forward<Args>(args)...);
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator where) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::erase(const_iterator where) {
     iterator next = where._const_cast();
     ++next;
 
@@ -699,8 +757,8 @@ typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator where) {
     return begin() + idx;
 }
 
-template<typename _Type>
-typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator first, const_iterator last) {
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::iterator Deque<_Type, _Alloc>::erase(const_iterator first, const_iterator last) {
     if (first == last) {
         return first._const_cast();
     } else if (first == begin() && first == end()) {
@@ -735,34 +793,34 @@ typename Deque<_Type>::iterator Deque<_Type>::erase(const_iterator first, const_
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::push_back(const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::push_back(const _Type& value) {
     if (_finish._curr != _finish._last - 1) {
         ::new(static_cast<void*>(&*_finish._curr)) _Type(value);
         ++_finish._curr;
     } else {
         _reserve_map_at_back();
-        *(_finish._node + 1) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+        *(_finish._node + 1) = _allocate_chunk();
         ::new(static_cast<void*>(&*_finish._curr)) _Type(value);
         _finish._set_node(_finish._node + 1);
         _finish._curr = _finish._first;
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::push_back(_Type&& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::push_back(_Type&& value) {
     emplace_back(std::move(value));
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-_Type& Deque<_Type>::emplace_back(Args&&... args) {
+_Type& Deque<_Type, _Alloc>::emplace_back(Args&&... args) {
     if (_finish._curr != _finish._last - 1) {
         ::new(static_cast<void*>(&*_finish._curr)) _Type(std::forward<Args>(args)...);
         ++_finish._curr;
     } else {
         _reserve_map_at_back();
-        *(_finish._node + 1) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+        *(_finish._node + 1) = _allocate_chunk();
         ::new(static_cast<void*>(&*_finish._curr)) _Type(std::forward<Args>(args)...);
         _finish._set_node(_finish._node + 1);
         _finish._curr = _finish._first;
@@ -771,47 +829,55 @@ _Type& Deque<_Type>::emplace_back(Args&&... args) {
     return back();
 }
 
-template<typename _Type>
-void Deque<_Type>::pop_back() {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::pop_back() {
     if (_finish._curr != _finish._first) {
         --_finish._curr;
         (*_finish._curr).~_Type();
     } else {
-        ::operator delete(&*_finish._first, CHUNK_SIZE * sizeof(_Type));
+        _deallocate_chunk(&*_finish._first);
         _finish._set_node(_finish._node - 1);
         _finish._curr = _finish._last - 1;
         (*_finish._curr).~_Type();
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::push_front(const _Type& value) {
+template<typename _Type, typename _Alloc>
+template<typename ForwardIt>
+void Deque<_Type, _Alloc>::append(ForwardIt first, ForwardIt last) {
+    iterator new_finish = _reserve_elements_at_back(std::distance(first, last));
+    _copy_map(first, last, _finish);
+    _finish = new_finish;
+}
+
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::push_front(const _Type& value) {
     if (_start._curr != _start._first) {
         ::new(static_cast<void*>(&*(_start._curr - 1))) _Type(value);
         --_start._curr;
     } else {
         _reserve_map_at_front();
-        *(_start._node - 1) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+        *(_start._node - 1) = _allocate_chunk();
         _start._set_node(_start._node - 1);
         _start._curr = _start._last - 1;
         ::new(static_cast<void*>(&*_start._curr)) _Type(value);
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::push_front(_Type&& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::push_front(_Type&& value) {
     emplace_front(std::move(value));
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-_Type& Deque<_Type>::emplace_front(Args&&... args) {
+_Type& Deque<_Type, _Alloc>::emplace_front(Args&&... args) {
     if (_start._curr != _start._first) {
         ::new(static_cast<void*>(&*(_start._curr - 1))) _Type(std::forward<Args>(args)...);
         --_start._curr;
     } else {
         _reserve_map_at_front();
-        *(_start._node - 1) = static_cast<_Elptr>(::operator new(CHUNK_SIZE * sizeof(_Type)));
+        *(_start._node - 1) = _allocate_chunk();
         _start._set_node(_start._node - 1);
         _start._curr = _start._last - 1;
         ::new(static_cast<void*>(&*_start._curr)) _Type(std::forward<Args>(args)...);
@@ -820,21 +886,21 @@ _Type& Deque<_Type>::emplace_front(Args&&... args) {
     return front();
 }
 
-template<typename _Type>
-void Deque<_Type>::pop_front() {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::pop_front() {
     if (_start._curr != _start._last - 1) {
         (*_start._curr).~_Type();
         ++_start._curr;
     } else {
         (*_start._curr).~_Type();
-        ::operator delete(&*_start._first, CHUNK_SIZE * sizeof(_Type));
+        _deallocate_chunk(&*_start._first);
         _start._set_node(_start._node + 1);
         _start._curr = _start._first;
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::resize(size_t new_size) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::resize(size_t new_size) {
     const size_t _size = size();
     if (new_size > _size) {
         for (size_t i = _size; i < new_size; ++i) 
@@ -845,8 +911,8 @@ void Deque<_Type>::resize(size_t new_size) {
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::resize(size_t new_size, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::resize(size_t new_size, const _Type& value) {
     const size_t _size = size();
     if (new_size > _size) {
         for (size_t i = _size; i < new_size; ++i) 
@@ -857,22 +923,29 @@ void Deque<_Type>::resize(size_t new_size, const _Type& value) {
     }
 }
 
-template<typename _Type>
-void Deque<_Type>::swap(Deque& other) {
+template<typename _Type, typename _Alloc>
+void Deque<_Type, _Alloc>::swap(Deque& other) {
     if (this != &other) {
         std::swap(_start, other._start);
         std::swap(_finish, other._finish);
         std::swap(_map, other._map);
         std::swap(_map_size, other._map_size);
+        std::swap(_alloc, other._alloc);
     }
 }
 
+template<typename _Type, typename _Alloc>
+typename Deque<_Type, _Alloc>::allocator_type Deque<_Type, _Alloc>::get_allocator() const {
+    return _alloc;
+}
+
 // definition of random access deque iterator class
 
 template<typename _Type, typename _Ref, typename _Ptr>
 class _DequeIterator {
 public:
-    friend class Deque<_Type>;
+    template<typename _DequeType, typename _Alloc>
+    friend class Deque;
 
 public:
     using iterator = _DequeIterator<_Type, _Type&, _Type*>;
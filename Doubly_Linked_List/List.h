@@ -2,6 +2,7 @@
 #define LIST_H
 
 #include <iostream>
+#include <memory>
 #include <algorithm>
 
 // interface of an open ends doubly-linked list data structure
@@ -20,12 +21,21 @@ struct _ListNode {
     _nodePtr _prev{ nullptr };
 };
 
-template<typename _Type>
+template<typename _Type, typename _Alloc = std::allocator<_Type>>
 class List {
 private:
     using _LNodePtr = _ListNode<_Type>*;
 
 public:
+    using value_type = _Type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = _Type&;
+    using const_reference = const _Type&;
+    using pointer = _Type*;
+    using const_pointer = const _Type*;
+    using allocator_type = _Alloc;
+
     using iterator = ListIterator<_Type, false>;
     using const_iterator = ListIterator<_Type, true>;
     using reverse_iterator = std::reverse_iterator<iterator>;
@@ -34,6 +44,8 @@ public:
     // ctors
     List();
 
+    explicit List(const _Alloc& alloc);
+
     explicit List(size_t count);
 
     List(size_t count, const _Type& value);
@@ -116,6 +128,7 @@ public:
     void swap(List& other);
 
     // operations
+    // merge, splice and move assignment relink nodes, so both Lists must use equal allocators
     void merge(List& source);
 
     template<typename Compare>
@@ -142,7 +155,18 @@ public:
     template<typename Compare>
     void sort(Compare comp);
 
+    allocator_type get_allocator() const;
+
 private:
+    // nodes are allocated through the element allocator rebound to _ListNode
+    using _NodeAlloc = typename std::allocator_traits<_Alloc>::template rebind_alloc<_ListNode<_Type>>;
+    using _NodeAllocTraits = std::allocator_traits<_NodeAlloc>;
+
+    template<typename... Args>
+    _LNodePtr _newNode(Args&&... args);
+
+    void _deleteNode(_LNodePtr node);
+
     void _constructSentinels(const _Type& value);
     
     template<typename... Args>
@@ -157,6 +181,7 @@ private:
     void _unhook(const_iterator iter);
 
 private:
+    [[no_unique_address]] _NodeAlloc _alloc; // node storage comes from here, std::allocator by default
     size_t _size; // the size of the List
     _LNodePtr _head; // _ListNode representing one before the first valid element - Sentinel
     _LNodePtr _tail; // _ListNode representing one after the last valid element - Sentinel
@@ -164,10 +189,27 @@ private:
 
 // List definition
 
-template<typename _Type>
-void List<_Type>::_constructSentinels(const _Type& value) {
-    _tail = new _ListNode(value);
-    _head = new _ListNode(value);
+template<typename _Type, typename _Alloc>
+template<typename... Args>
+typename List<_Type, _Alloc>::_LNodePtr List<_Type, _Alloc>::_newNode(Args&&... args) {
+    _LNodePtr node = _NodeAllocTraits::allocate(_alloc, 1);
+    _NodeAllocTraits::construct(_alloc, node, std::forward<Args>(args)...);
+
+    return node;
+}
+
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_deleteNode(_LNodePtr node) {
+    if (node != nullptr) {
+        _NodeAllocTraits::destroy(_alloc, node);
+        _NodeAllocTraits::deallocate(_alloc, node, 1);
+    }
+}
+
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_constructSentinels(const _Type& value) {
+    _tail = _newNode(value);
+    _head = _newNode(value);
 
     // hook up both sentinels
     _head->_next = _tail;
@@ -176,10 +218,10 @@ void List<_Type>::_constructSentinels(const _Type& value) {
     _size = 0;
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-typename List<_Type>::iterator List<_Type>::_constructInternalNode(const_iterator where, Args&&... args) {
-    _LNodePtr newMidNode = new _ListNode(std::forward<Args>(args)...);
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::_constructInternalNode(const_iterator where, Args&&... args) {
+    _LNodePtr newMidNode = _newNode(std::forward<Args>(args)...);
 
     // hook up to the new node 
     newMidNode->_prev = where._nodePtr->_prev;
@@ -194,15 +236,15 @@ typename List<_Type>::iterator List<_Type>::_constructInternalNode(const_iterato
     return newMidNode;
 }
 
-template<typename _Type>
-void List<_Type>::_fillNodes(size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_fillNodes(size_t count, const _Type& value) {
     for (size_t i = 0; i < count; i++) {
         _constructInternalNode(cend(), value);
     }
 }
 
-template<typename _Type>
-void List<_Type>::_transferNodes(const_iterator where, const_iterator first, const_iterator last) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_transferNodes(const_iterator where, const_iterator first, const_iterator last) {
     // splice [first, last) before where
     if (where != first && where != last && first != last) {
         // hook up first
@@ -215,8 +257,8 @@ void List<_Type>::_transferNodes(const_iterator where, const_iterator first, con
     }
 }
 
-template<typename _Type>
-void List<_Type>::_invalidateList(List& source) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_invalidateList(List& source) {
     // rehook-up sentinels
     source._head->_next = source._tail;
     source._tail->_prev = source._head;
@@ -224,8 +266,8 @@ void List<_Type>::_invalidateList(List& source) {
     source._size = 0;
 }
 
-template<typename _Type>
-void List<_Type>::_unhook(const_iterator iter) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::_unhook(const_iterator iter) {
     // unhook node at iter position
     iter._nodePtr->_prev->_next = iter._nodePtr->_next;
     iter._nodePtr->_next->_prev = iter._nodePtr->_prev;
@@ -233,54 +275,60 @@ void List<_Type>::_unhook(const_iterator iter) {
     --_size;
 }
 
-template<typename _Type>
-List<_Type>::List() : _size(0), _head(nullptr), _tail(nullptr) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List() : _size(0), _head(nullptr), _tail(nullptr) {
     _constructSentinels(_Type());
 } 
 
-template<typename _Type>
-List<_Type>::List(size_t count) : _size(0), _head(nullptr), _tail(nullptr) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(const _Alloc& alloc) : _alloc(alloc), _size(0), _head(nullptr), _tail(nullptr) {
+    _constructSentinels(_Type());
+}
+
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(size_t count) : _size(0), _head(nullptr), _tail(nullptr) {
     _constructSentinels(_Type());
     _fillNodes(count, _Type());
 }
 
-template<typename _Type>
-List<_Type>::List(size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(size_t count, const _Type& value) {
     _constructSentinels(value);
     _fillNodes(count, value);
 }
 
-template<typename _Type>
-List<_Type>::List(const List& source) : _size(0), _head(nullptr), _tail(nullptr) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(const List& source) :
+    _alloc(_NodeAllocTraits::select_on_container_copy_construction(source._alloc)), _size(0), _head(nullptr), _tail(nullptr) {
     _constructSentinels(_Type());
     for (auto it = source.begin(); it != source.end(); it++) {
         _constructInternalNode(cend(), *it);
     }
 }
 
-template<typename _Type>
-List<_Type>::List(List&& source) : _size(0), _head(nullptr), _tail(nullptr) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(List&& source) : _alloc(source._alloc), _size(0), _head(nullptr), _tail(nullptr) {
     _constructSentinels(_Type());
     splice(cend(), source);
 }
 
-template<typename _Type>
-List<_Type>::List(std::initializer_list<_Type> ilist) :_size(0), _head(nullptr), _tail(nullptr) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::List(std::initializer_list<_Type> ilist) :_size(0), _head(nullptr), _tail(nullptr) {
     _constructSentinels(_Type());
     for (auto it = ilist.begin(); it != ilist.end(); it++) {
         _constructInternalNode(cend(), *it);
     }
 }
 
-template<typename _Type>
-List<_Type>::~List() {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>::~List() {
     clear();
-    delete _tail;
-    delete _head;
+    _deleteNode(_tail);
+    _deleteNode(_head);
 }
 
-template<typename _Type>
-List<_Type>& List<_Type>::operator=(const List& right) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>& List<_Type, _Alloc>::operator=(const List& right) {
     if (this != std::addressof(right)) {
         clear();
         for (auto it = right.begin(); it != right.end(); it++) {
@@ -291,8 +339,8 @@ List<_Type>& List<_Type>::operator=(const List& right) {
     return *this;
 }
 
-template<typename _Type> 
-List<_Type>& List<_Type>::operator=(List&& right) {
+template<typename _Type, typename _Alloc>
+List<_Type, _Alloc>& List<_Type, _Alloc>::operator=(List&& right) {
     if (this != std::addressof(right)) {
         clear();
         splice(cend(), right);
@@ -301,8 +349,8 @@ List<_Type>& List<_Type>::operator=(List&& right) {
     return *this;    
 }
 
-template<typename _Type>
-_Type& List<_Type>::front() {
+template<typename _Type, typename _Alloc>
+_Type& List<_Type, _Alloc>::front() {
     if (empty()) {
         std::cerr << "front() called on empty List" << std::endl;
     }
@@ -310,8 +358,8 @@ _Type& List<_Type>::front() {
     return _head->_next->_data;
 }
 
-template<typename _Type>
-const _Type& List<_Type>::front() const {
+template<typename _Type, typename _Alloc>
+const _Type& List<_Type, _Alloc>::front() const {
     if (empty()) {
         std::cerr << "front() called on empty List" << std::endl;
     }
@@ -319,8 +367,8 @@ const _Type& List<_Type>::front() const {
     return _head->_next->_data;
 }
 
-template<typename _Type>
-_Type& List<_Type>::back() {
+template<typename _Type, typename _Alloc>
+_Type& List<_Type, _Alloc>::back() {
     if (empty()) {
         std::cerr << "back() called on empty List" << std::endl;
     }
@@ -328,8 +376,8 @@ _Type& List<_Type>::back() {
     return _tail->_prev->_data;
 }
 
-template<typename _Type>
-const _Type& List<_Type>::back() const {
+template<typename _Type, typename _Alloc>
+const _Type& List<_Type, _Alloc>::back() const {
     if (empty()) {
         std::cerr << "back() called on empty List" << std::endl;
     }
@@ -337,85 +385,85 @@ const _Type& List<_Type>::back() const {
     return _tail->_prev->_data;
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::begin() {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::begin() {
     return iterator(_head->_next);
 }
 
-template<typename _Type>
-typename List<_Type>::const_iterator List<_Type>::begin() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_iterator List<_Type, _Alloc>::begin() const {
     return const_iterator(_head->_next);
 }
 
-template<typename _Type>
-typename List<_Type>::const_iterator List<_Type>::cbegin() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_iterator List<_Type, _Alloc>::cbegin() const {
     return const_iterator(_head->_next);
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::end() {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::end() {
     return iterator(_tail);
 }
 
-template<typename _Type>
-typename List<_Type>::const_iterator List<_Type>::end() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_iterator List<_Type, _Alloc>::end() const {
     return const_iterator(_tail);
 }
 
-template<typename _Type>
-typename List<_Type>::const_iterator List<_Type>::cend() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_iterator List<_Type, _Alloc>::cend() const {
     return const_iterator(_tail);
 }
 
-template<typename _Type>
-typename List<_Type>::reverse_iterator List<_Type>::rbegin() {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::reverse_iterator List<_Type, _Alloc>::rbegin() {
     return reverse_iterator(end());
 }
 
-template<typename _Type>
-typename List<_Type>::const_reverse_iterator List<_Type>::rbegin() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_reverse_iterator List<_Type, _Alloc>::rbegin() const {
     return const_reverse_iterator(end());
 }
 
-template<typename _Type>
-typename List<_Type>::const_reverse_iterator List<_Type>::crbegin() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_reverse_iterator List<_Type, _Alloc>::crbegin() const {
     return const_reverse_iterator(end());
 }
 
-template<typename _Type>
-typename List<_Type>::reverse_iterator List<_Type>::rend() {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::reverse_iterator List<_Type, _Alloc>::rend() {
     return reverse_iterator(begin());
 }
 
-template<typename _Type>
-typename List<_Type>::const_reverse_iterator List<_Type>::rend() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_reverse_iterator List<_Type, _Alloc>::rend() const {
     return const_reverse_iterator(begin());
 }
 
-template<typename _Type>
-typename List<_Type>::const_reverse_iterator List<_Type>::crend() const {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::const_reverse_iterator List<_Type, _Alloc>::crend() const {
     return const_reverse_iterator(begin());
 }
 
-template<typename _Type>
-bool List<_Type>::empty() const {
+template<typename _Type, typename _Alloc>
+bool List<_Type, _Alloc>::empty() const {
     return size() == 0;
 }
 
-template<typename _Type>
-size_t List<_Type>::size() const {
+template<typename _Type, typename _Alloc>
+size_t List<_Type, _Alloc>::size() const {
     return _size;
 }
 
-template<typename _Type>
-void List<_Type>::clear() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::clear() {
     while (!empty()) {
         pop_front();
     }
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::insert(const_iterator where, const _Type& value) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::insert(const_iterator where, const _Type& value) {
     if (!where._nodePtr) { // nullptr
         std::cerr << "insert() called with invalid position" << std::endl;
         return end();
@@ -428,8 +476,8 @@ typename List<_Type>::iterator List<_Type>::insert(const_iterator where, const _
     return _constructInternalNode(where, value);
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::insert(const_iterator where, _Type&& value) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::insert(const_iterator where, _Type&& value) {
     if (!where._nodePtr) { // nullptr or empty List
         std::cerr << "insert() called with invalid position" << std::endl;
         return end();
@@ -442,8 +490,8 @@ typename List<_Type>::iterator List<_Type>::insert(const_iterator where, _Type&&
     return _constructInternalNode(where, std::move(value));
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::insert(const_iterator where, size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::insert(const_iterator where, size_t count, const _Type& value) {
     for (size_t i = 0; i < count; i++) {
         insert(where, value);
     }
@@ -451,9 +499,9 @@ typename List<_Type>::iterator List<_Type>::insert(const_iterator where, size_t
     return where._nodePtr->_prev;
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-typename List<_Type>::iterator List<_Type>::emplace(const_iterator where, Args&&... args) {
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::emplace(const_iterator where, Args&&... args) {
     if (!where._nodePtr) { // nullptr
         std::cerr << "emplace() called with invalid position" << std::endl;
         return end();
@@ -462,8 +510,8 @@ typename List<_Type>::iterator List<_Type>::emplace(const_iterator where, Args&&
     return _constructInternalNode(where, _Type(std::forward<Args>(args)...));
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::erase(const_iterator where) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::erase(const_iterator where) {
     if (empty()) {
         std::cerr << "erase() called on empty List" << std::endl;
         return end();
@@ -480,13 +528,13 @@ typename List<_Type>::iterator List<_Type>::erase(const_iterator where) {
     // unhook target node for delete
     _unhook(retiredNode);
 
-    delete retiredNode;
+    _deleteNode(retiredNode);
 
     return iterator(where._nodePtr);
 }
 
-template<typename _Type>
-typename List<_Type>::iterator List<_Type>::erase(const_iterator first, const_iterator last) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::iterator List<_Type, _Alloc>::erase(const_iterator first, const_iterator last) {
     for (; first != last; ) {
         first = static_cast<const_iterator>(erase(first));
     }
@@ -494,61 +542,61 @@ typename List<_Type>::iterator List<_Type>::erase(const_iterator first, const_it
     return iterator(last._nodePtr);
 }
 
-template<typename _Type>
-void List<_Type>::push_back(const _Type& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::push_back(const _Type& value) {
     _constructInternalNode(cend(), value);
 }
 
-template<typename _Type>
-void List<_Type>::push_back(_Type&& value)  {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::push_back(_Type&& value)  {
     _constructInternalNode(cend(), std::move(value));
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-_Type& List<_Type>::emplace_back(Args&&... args) {
+_Type& List<_Type, _Alloc>::emplace_back(Args&&... args) {
     _constructInternalNode(cend(), _Type(std::forward<Args>(args)...));
     return back();
 }
 
-template<typename _Type>
-void List<_Type>::pop_back() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::pop_back() {
     _LNodePtr backNode = _tail->_prev;
     _unhook(backNode);
-    delete backNode;
+    _deleteNode(backNode);
 }
 
-template<typename _Type>
-void List<_Type>::push_front(const _Type& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::push_front(const _Type& value) {
     _constructInternalNode(cbegin(), value);
 }
 
-template<typename _Type>
-void List<_Type>::push_front(_Type&& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::push_front(_Type&& value) {
     _constructInternalNode(cbegin(), std::move(value));
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-_Type& List<_Type>::emplace_front(Args&&... args) {
+_Type& List<_Type, _Alloc>::emplace_front(Args&&... args) {
     _constructInternalNode(cbegin(), _Type(std::forward<Args>(args)...));
     return front();
 }
 
-template<typename _Type>
-void List<_Type>::pop_front() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::pop_front() {
     _LNodePtr frontNode = _head->_next;
     _unhook(frontNode);
-    delete frontNode;
+    _deleteNode(frontNode);
 }
 
-template<typename _Type>
-void List<_Type>::resize(size_t count) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::resize(size_t count) {
     resize(count, _Type());
 }
 
-template<typename _Type>
-void List<_Type>::resize(size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::resize(size_t count, const _Type& value) {
     if (count < size()) {
         while (count != size()) {
             pop_back();
@@ -560,17 +608,23 @@ void List<_Type>::resize(size_t count, const _Type& value) {
     }
 }
 
-template<typename _Type>
-void List<_Type>::swap(List& other) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::swap(List& other) {
     if (this != std::addressof(other)) {
+        std::swap(_alloc, other._alloc);
         std::swap(_head, other._head);
         std::swap(_tail, other._tail);
         std::swap(_size, other._size);
     }
 }
 
-template<typename _Type>
-void List<_Type>::merge(List& source) {
+template<typename _Type, typename _Alloc>
+typename List<_Type, _Alloc>::allocator_type List<_Type, _Alloc>::get_allocator() const {
+    return allocator_type(_alloc);
+}
+
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::merge(List& source) {
     if (!source.empty() && this != std::addressof(source)) {
         iterator first = begin();
         iterator last = end();
@@ -596,9 +650,9 @@ void List<_Type>::merge(List& source) {
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename Compare>
-void List<_Type>::merge(List& source, Compare comp) {
+void List<_Type, _Alloc>::merge(List& source, Compare comp) {
     if (!source.empty() && this != std::addressof(source)) {
         iterator first = begin();
         iterator last = end();
@@ -624,8 +678,8 @@ void List<_Type>::merge(List& source, Compare comp) {
     }
 }
 
-template<typename _Type>
-void List<_Type>::splice(const_iterator where, List& source) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::splice(const_iterator where, List& source) {
     if (!source.empty() && this != std::addressof(source)) {
         _transferNodes(where, source.cbegin(), source.cend());
         _size += source.size();
@@ -633,8 +687,8 @@ void List<_Type>::splice(const_iterator where, List& source) {
     }
 }   
 
-template<typename _Type>
-void List<_Type>::splice(const_iterator where, List& source, const_iterator iter) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::splice(const_iterator where, List& source, const_iterator iter) {
     if (!source.empty() && this != std::addressof(source)) {
         source._unhook(iter);
 
@@ -650,8 +704,8 @@ void List<_Type>::splice(const_iterator where, List& source, const_iterator iter
     }
 }
 
-template<typename _Type>
-void List<_Type>::splice(const_iterator where, List& source, const_iterator first, const_iterator last) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::splice(const_iterator where, List& source, const_iterator first, const_iterator last) {
     if (!source.empty() && this != std::addressof(source)) {
         while (first != last) {
             splice(where, source, first++);
@@ -659,8 +713,8 @@ void List<_Type>::splice(const_iterator where, List& source, const_iterator firs
     }
 }
 
-template<typename _Type>
-void List<_Type>::remove(const _Type& value) {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::remove(const _Type& value) {
     iterator first = begin();
     iterator last = end();
 
@@ -674,9 +728,9 @@ void List<_Type>::remove(const _Type& value) {
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename UnaryPredicate>
-void List<_Type>::remove_if(UnaryPredicate pred) {
+void List<_Type, _Alloc>::remove_if(UnaryPredicate pred) {
     iterator first = begin();
     iterator last = end();
 
@@ -690,8 +744,8 @@ void List<_Type>::remove_if(UnaryPredicate pred) {
     }    
 }
 
-template<typename _Type>
-void List<_Type>::reverse() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::reverse() {
     iterator first = begin();
     iterator last = end();
 
@@ -705,8 +759,8 @@ void List<_Type>::reverse() {
     }
 }
 
-template<typename _Type>
-void List<_Type>::unique() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::unique() {
     iterator first = begin();
     iterator last = end();
 
@@ -725,9 +779,9 @@ void List<_Type>::unique() {
     }
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename BinaryPredicate>
-void List<_Type>::unique(BinaryPredicate bpred) {
+void List<_Type, _Alloc>::unique(BinaryPredicate bpred) {
     iterator first = begin();
     iterator last = end();
 
@@ -746,8 +800,8 @@ void List<_Type>::unique(BinaryPredicate bpred) {
     }
 }
 
-template<typename _Type>
-void List<_Type>::sort() {
+template<typename _Type, typename _Alloc>
+void List<_Type, _Alloc>::sort() {
     // stolen from glibc
     List carry;
     List buckets[64];
@@ -782,7 +836,8 @@ void List<_Type>::sort() {
 template<typename _ListIterValType, bool _IsConst>
 class ListIterator {
 private:
-    friend class List<_ListIterValType>;
+    template<typename _Type, typename _Alloc>
+    friend class List;
 
 public:
     using _Iterator = ListIterator<_ListIterValType, _IsConst>;
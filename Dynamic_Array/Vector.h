@@ -2,8 +2,12 @@
 #define VECTOR_H
 
 #include <memory>
+#include <iterator>
 #include <exception>
 
+#include "../Utility/Compare.h"
+#include "../Utility/Hash.h"
+
 // interface of custum dynamically-sized heap-allocated Vector (std::vector)
 
 namespace constants {
@@ -11,9 +15,18 @@ namespace constants {
     constexpr float MEM_GROWTH = 1.5f;
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc = std::allocator<_Type>>
 class Vector {
 public:
+    using value_type = _Type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = _Type&;
+    using const_reference = const _Type&;
+    using pointer = _Type*;
+    using const_pointer = const _Type*;
+    using allocator_type = _Alloc;
+
     using iterator = _Type*;
     using const_iterator = const _Type*;
     using reverse_iterator = std::reverse_iterator<iterator>;
@@ -22,13 +35,15 @@ public:
     // ctors
     Vector();
 
-    explicit Vector(size_t size);
-    Vector(size_t size, const _Type& initValue);
+    explicit Vector(const _Alloc& alloc);
+
+    explicit Vector(size_t size, const _Alloc& alloc = _Alloc());
+    Vector(size_t size, const _Type& initValue, const _Alloc& alloc = _Alloc());
 
     Vector(const Vector& source);
     Vector(Vector&& source);
 
-    Vector(std::initializer_list<_Type> initList);
+    Vector(std::initializer_list<_Type> initList, const _Alloc& alloc = _Alloc());
 
     // destructor
     ~Vector();
@@ -119,15 +134,30 @@ public:
 
     constexpr void pop_back();
 
+    // copies [first, last) to the end with at most one reallocation
+    template<typename ForwardIt>
+    constexpr void append(ForwardIt first, ForwardIt last);
+
     constexpr void resize(size_t newSize, const _Type& value);
 
     constexpr void swap(Vector& other);
 
+    // operations
+    size_t hash() const;
+
+    allocator_type get_allocator() const;
+
 private:
+    using _AllocTraits = std::allocator_traits<_Alloc>;
+
+    _Type* _allocate(size_t capacity);
+    void _deallocate(_Type* data, size_t capacity);
+
     void _reAllocMem(size_t newCapacity);
     void _moveBackward(size_t first, size_t last);
 
 private:
+    [[no_unique_address]] _Alloc _alloc; // storage comes from here, std::allocator by default
     size_t _size;
     size_t _capacity;
     _Type* _data;
@@ -135,12 +165,24 @@ private:
 
 // Vector definition
 
-template<typename _Type>
-void Vector<_Type>::_reAllocMem(size_t capacity) {
+template<typename _Type, typename _Alloc>
+_Type* Vector<_Type, _Alloc>::_allocate(size_t capacity) {
+    return _AllocTraits::allocate(_alloc, capacity);
+}
+
+template<typename _Type, typename _Alloc>
+void Vector<_Type, _Alloc>::_deallocate(_Type* data, size_t capacity) {
+    if (data != nullptr) {
+        _AllocTraits::deallocate(_alloc, data, capacity);
+    }
+}
+
+template<typename _Type, typename _Alloc>
+void Vector<_Type, _Alloc>::_reAllocMem(size_t capacity) {
 
     size_t newCapacity = std::max(constants::INIT_CAPACITY, capacity);
 
-    _Type* newData = static_cast<_Type*>(::operator new(newCapacity * sizeof(_Type)));
+    _Type* newData = _allocate(newCapacity);
 
     for (size_t i = 0; i < _size; i++) {
         newData[i] = std::move(_data[i]);
@@ -149,75 +191,83 @@ void Vector<_Type>::_reAllocMem(size_t capacity) {
     for (size_t i = 0; i < _size; i++) {
         _data[_size - 1 - i].~_Type();
     }
-    ::operator delete(_data, _capacity * sizeof(_Type));
+    _deallocate(_data, _capacity);
 
     _data = newData;
     _capacity = newCapacity;
 }
 
-template<typename _Type>
-void Vector<_Type>::_moveBackward(size_t first, size_t last) {
+template<typename _Type, typename _Alloc>
+void Vector<_Type, _Alloc>::_moveBackward(size_t first, size_t last) {
     for (size_t i = last; i > first; i--) {
         _data[i] = _data[i - 1];
     }
 }
 
-template<typename _Type>
-Vector<_Type>::Vector() : _size(0), _capacity(0), _data(nullptr) {}
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector() : _alloc(), _size(0), _capacity(0), _data(nullptr) {}
 
-template<typename _Type>
-Vector<_Type>::Vector(size_t size) : 
-    _size(size), _capacity(size), _data(static_cast<_Type*>(::operator new(size * sizeof(_Type)))) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(const _Alloc& alloc) : _alloc(alloc), _size(0), _capacity(0), _data(nullptr) {}
+
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(size_t size, const _Alloc& alloc) : 
+    _alloc(alloc), _size(size), _capacity(size), _data(_allocate(size)) {
     
     for (size_t i = 0; i < _size; i++) {
         _data[i] = _Type();
     }
 }
 
-template<typename _Type>
-Vector<_Type>::Vector(size_t size, const _Type& initValue) : 
-    _size(size), _capacity(size), _data(static_cast<_Type*>(::operator new(size * sizeof(_Type)))) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(size_t size, const _Type& initValue, const _Alloc& alloc) : 
+    _alloc(alloc), _size(size), _capacity(size), _data(_allocate(size)) {
 
     for (size_t i = 0; i < _size; i++) {
         _data[i] = initValue;
     }
 }
 
-template<typename _Type>
-Vector<_Type>::Vector(const Vector<_Type>& source) : 
-    _size(source._size), _capacity(source._capacity), _data(static_cast<_Type*>(::operator new(source._capacity * sizeof(_Type)))) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(const Vector<_Type, _Alloc>& source) : 
+    _alloc(_AllocTraits::select_on_container_copy_construction(source._alloc)), _size(source._size), _capacity(source._capacity), _data(_allocate(source._capacity)) {
 
     std::copy(source._data, source._data + source._capacity, _data);   
 }
 
-template<typename _Type>
-Vector<_Type>::Vector(Vector<_Type>&& source) : _size(0), _capacity(0), _data(nullptr) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(Vector<_Type, _Alloc>&& source) : _alloc(source._alloc), _size(0), _capacity(0), _data(nullptr) {
     *this = std::move(source);   
 }
 
-template<typename _Type>
-Vector<_Type>::Vector(std::initializer_list<_Type> initList) : 
-    _size(initList.size()), _capacity(initList.size()), _data(static_cast<_Type*>(::operator new(_capacity * sizeof(_Type)))) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::Vector(std::initializer_list<_Type> initList, const _Alloc& alloc) : 
+    _alloc(alloc), _size(initList.size()), _capacity(initList.size()), _data(_allocate(_capacity)) {
 
     std::copy(initList.begin(), initList.end(), _data);   
 }
 
-template<typename _Type>
-Vector<_Type>::~Vector() {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>::~Vector() {
     clear();
-    ::operator delete(_data, _capacity * sizeof(_Type));
+    _deallocate(_data, _capacity);
 }
 
-template<typename _Type>
-Vector<_Type>& Vector<_Type>::operator=(const Vector& right) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>& Vector<_Type, _Alloc>::operator=(const Vector& right) {
     if (this != &right) {
         if (_data) {
             clear();
+            _deallocate(_data, _capacity);
         }
 
+        // the old buffer went back to the old allocator, the new one comes from right's if it propagates
+        if constexpr (_AllocTraits::propagate_on_container_copy_assignment::value) {
+            _alloc = right._alloc;
+        }
         _size = right._size;
         _capacity = right._capacity;
-        _data = static_cast<_Type*>(::operator new(right._capacity * sizeof(_Type)));
+        _data = _allocate(right._capacity);
 
         std::copy(right._data, right._data + right._capacity, _data);
     }
@@ -225,13 +275,16 @@ Vector<_Type>& Vector<_Type>::operator=(const Vector& right) {
     return *this;
 }
 
-template<typename _Type>
-Vector<_Type>& Vector<_Type>::operator=(Vector&& right) {
+template<typename _Type, typename _Alloc>
+Vector<_Type, _Alloc>& Vector<_Type, _Alloc>::operator=(Vector&& right) {
     if (this != &right) {
         if (_data) {
             clear();
+            _deallocate(_data, _capacity);
         }
 
+        // the storage moves over, so the allocator that owns it has to come along
+        _alloc = right._alloc;
         _size = right._size;
         _capacity = right._capacity;
         _data = right._data;
@@ -245,8 +298,8 @@ Vector<_Type>& Vector<_Type>::operator=(Vector&& right) {
     return *this;
 }
 
-template<typename _Type>
-constexpr _Type& Vector<_Type>::at(size_t idx) {
+template<typename _Type, typename _Alloc>
+constexpr _Type& Vector<_Type, _Alloc>::at(size_t idx) {
     if (idx >= size()) {
         throw std::out_of_range("Vector Error: Index out of bounds!");
     }
@@ -254,8 +307,8 @@ constexpr _Type& Vector<_Type>::at(size_t idx) {
     return _data[idx];
 }
 
-template<typename _Type>
-constexpr const _Type& Vector<_Type>::at(size_t idx) const {
+template<typename _Type, typename _Alloc>
+constexpr const _Type& Vector<_Type, _Alloc>::at(size_t idx) const {
     if (idx >= size()) {
         throw std::out_of_range("Vector Error: Index out of bounds!");
     }
@@ -263,58 +316,58 @@ constexpr const _Type& Vector<_Type>::at(size_t idx) const {
     return _data[idx];
 }
 
-template<typename _Type>
-constexpr _Type& Vector<_Type>::operator[](size_t idx) {
+template<typename _Type, typename _Alloc>
+constexpr _Type& Vector<_Type, _Alloc>::operator[](size_t idx) {
     return _data[idx];
 }
 
-template<typename _Type>
-constexpr const _Type& Vector<_Type>::operator[](size_t idx) const {
+template<typename _Type, typename _Alloc>
+constexpr const _Type& Vector<_Type, _Alloc>::operator[](size_t idx) const {
     return _data[idx];
 }
 
-template<typename _Type>
-constexpr _Type& Vector<_Type>::front() {
+template<typename _Type, typename _Alloc>
+constexpr _Type& Vector<_Type, _Alloc>::front() {
     return _data[0];
 }
 
-template<typename _Type>
-constexpr const _Type& Vector<_Type>::front() const {
+template<typename _Type, typename _Alloc>
+constexpr const _Type& Vector<_Type, _Alloc>::front() const {
     return _data[0];
 }
 
-template<typename _Type>
-constexpr _Type& Vector<_Type>::back() {
+template<typename _Type, typename _Alloc>
+constexpr _Type& Vector<_Type, _Alloc>::back() {
     return _data[_size - 1];
 }
 
-template<typename _Type>
-constexpr const _Type& Vector<_Type>::back() const {
+template<typename _Type, typename _Alloc>
+constexpr const _Type& Vector<_Type, _Alloc>::back() const {
     return _data[_size - 1];
 }
 
-template<typename _Type>
-constexpr _Type* Vector<_Type>::data() {
+template<typename _Type, typename _Alloc>
+constexpr _Type* Vector<_Type, _Alloc>::data() {
     return _data;
 }
 
-template<typename _Type>
-constexpr const _Type* Vector<_Type>::data() const {
+template<typename _Type, typename _Alloc>
+constexpr const _Type* Vector<_Type, _Alloc>::data() const {
     return _data;
 }
 
-template<typename _Type>
-constexpr bool Vector<_Type>::empty() const {
+template<typename _Type, typename _Alloc>
+constexpr bool Vector<_Type, _Alloc>::empty() const {
     return size() == 0;
 }
 
-template<typename _Type>
-constexpr size_t Vector<_Type>::size() const {
+template<typename _Type, typename _Alloc>
+constexpr size_t Vector<_Type, _Alloc>::size() const {
     return _size;
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::reserve(size_t newCapacity) {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::reserve(size_t newCapacity) {
     // in case of shrinking
     if (newCapacity < _size) {
         _size = newCapacity;
@@ -325,18 +378,18 @@ constexpr void Vector<_Type>::reserve(size_t newCapacity) {
     _reAllocMem(newCapacity);
 }
 
-template<typename _Type>
-constexpr size_t Vector<_Type>::capacity() const {
+template<typename _Type, typename _Alloc>
+constexpr size_t Vector<_Type, _Alloc>::capacity() const {
     return _capacity;
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::shrink_to_fit() {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::shrink_to_fit() {
     _reAllocMem(_size);
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::clear() {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::clear() {
     // calls the destructor of each element in reverse order
     for (size_t i = 0; i < _size; i++) {
         _data[_size - 1 - i].~_Type();
@@ -345,18 +398,18 @@ constexpr void Vector<_Type>::clear() {
     _size = 0;
 }  
 
-template<typename _Type>
-constexpr typename Vector<_Type>::iterator Vector<_Type>::insert(const_iterator where, const _Type& value) {
+template<typename _Type, typename _Alloc>
+constexpr typename Vector<_Type, _Alloc>::iterator Vector<_Type, _Alloc>::insert(const_iterator where, const _Type& value) {
     return emplace(where, value);
 }
 
-template<typename _Type>
-constexpr typename Vector<_Type>::iterator Vector<_Type>::insert(const_iterator where, _Type&& value) {
+template<typename _Type, typename _Alloc>
+constexpr typename Vector<_Type, _Alloc>::iterator Vector<_Type, _Alloc>::insert(const_iterator where, _Type&& value) {
     return emplace(where, std::forward<_Type>(value));
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::insert(const_iterator where, size_t count, const _Type& value) {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::insert(const_iterator where, size_t count, const _Type& value) {
     const auto distance = where - cbegin();
 
     if (_size + count < _capacity) {
@@ -380,8 +433,8 @@ constexpr void Vector<_Type>::insert(const_iterator where, size_t count, const _
     }
 }
 
-template<typename _Type>
-constexpr typename Vector<_Type>::iterator Vector<_Type>::erase(const_iterator where) {
+template<typename _Type, typename _Alloc>
+constexpr typename Vector<_Type, _Alloc>::iterator Vector<_Type, _Alloc>::erase(const_iterator where) {
     const size_t distance = where - cbegin();
     
     // check if where is before the last valid element in the Vector
@@ -398,8 +451,8 @@ constexpr typename Vector<_Type>::iterator Vector<_Type>::erase(const_iterator w
     return &_data[distance];
 }
 
-template<typename _Type>
-constexpr typename Vector<_Type>::iterator Vector<_Type>::erase(const_iterator first, const_iterator last) {
+template<typename _Type, typename _Alloc>
+constexpr typename Vector<_Type, _Alloc>::iterator Vector<_Type, _Alloc>::erase(const_iterator first, const_iterator last) {
     const size_t distance = last - first;
     const size_t start = first - cbegin();
 
@@ -407,7 +460,7 @@ constexpr typename Vector<_Type>::iterator Vector<_Type>::erase(const_iterator f
         _data[i] = _data[i + distance];
     }
 
-    for (size_t i = _size - 1; i > _size - distance; i--) {
+    for (size_t i = _size - distance; i < _size; i++) {
         _data[i].~_Type();
     }
 
@@ -416,9 +469,9 @@ constexpr typename Vector<_Type>::iterator Vector<_Type>::erase(const_iterator f
     return &_data[start];
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template<typename... Args>
-constexpr typename Vector<_Type>::iterator Vector<_Type>::emplace(const_iterator where, Args&&... args) {
+constexpr typename Vector<_Type, _Alloc>::iterator Vector<_Type, _Alloc>::emplace(const_iterator where, Args&&... args) {
     const auto distance = where - cbegin();
 
     if (_size != _capacity) {
@@ -440,8 +493,8 @@ constexpr typename Vector<_Type>::iterator Vector<_Type>::emplace(const_iterator
     return it;
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::push_back(const _Type& value) {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::push_back(const _Type& value) {
     if (_size >= _capacity) {
         _reAllocMem(_capacity * constants::MEM_GROWTH);
     }
@@ -449,8 +502,8 @@ constexpr void Vector<_Type>::push_back(const _Type& value) {
     _data[_size++] = value;
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::push_back(_Type&& value) {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::push_back(_Type&& value) {
     if (_size >= _capacity) {
         _reAllocMem(_capacity * constants::MEM_GROWTH);
     }
@@ -458,9 +511,9 @@ constexpr void Vector<_Type>::push_back(_Type&& value) {
     _data[_size++] = std::move(value);
 }
 
-template<typename _Type>
+template<typename _Type, typename _Alloc>
 template <typename... Args>
-constexpr _Type& Vector<_Type>::emplace_back(Args&&... args) {
+constexpr _Type& Vector<_Type, _Alloc>::emplace_back(Args&&... args) {
     if (_size >= _capacity) {
         _reAllocMem(_capacity * constants::MEM_GROWTH);
     }
@@ -470,16 +523,30 @@ constexpr _Type& Vector<_Type>::emplace_back(Args&&... args) {
     return _data[_size++];
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::pop_back() {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::pop_back() {
     if (_size > 0) {
         _size--;
         _data[_size].~_Type();
     }
 } 
 
-template<typename _Type>
-constexpr void Vector<_Type>::resize(size_t newSize, const _Type& value) {
+template<typename _Type, typename _Alloc>
+template<typename ForwardIt>
+constexpr void Vector<_Type, _Alloc>::append(ForwardIt first, ForwardIt last) {
+    const size_t count = std::distance(first, last);
+
+    if (_size + count > _capacity) {
+        _reAllocMem(std::max(_size + count, static_cast<size_t>(_capacity * constants::MEM_GROWTH)));
+    }
+
+    for (; first != last; ++first) {
+        new(&_data[_size++]) _Type(*first);
+    }
+}
+
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::resize(size_t newSize, const _Type& value) {
     if (newSize > _size) {
         if (newSize < _capacity) {
             // construct elements inplace until reaches requested newSize
@@ -505,13 +572,43 @@ constexpr void Vector<_Type>::resize(size_t newSize, const _Type& value) {
     }
 }
 
-template<typename _Type>
-constexpr void Vector<_Type>::swap(Vector& other) {
+template<typename _Type, typename _Alloc>
+constexpr void Vector<_Type, _Alloc>::swap(Vector& other) {
     if (this != &other) {
+        std::swap(_alloc, other._alloc);
         std::swap(_data, other._data);
         std::swap(_size, other._size);
         std::swap(_capacity, other._capacity);
     }
 }
 
+template<typename _Type, typename _Alloc>
+size_t Vector<_Type, _Alloc>::hash() const {
+    return hashing::hashRange(data(), size());
+}
+
+template<typename _Type, typename _Alloc>
+typename Vector<_Type, _Alloc>::allocator_type Vector<_Type, _Alloc>::get_allocator() const {
+    return _alloc;
+}
+
+// non-member comparison operators (operator!= and the relational operators are synthesized from these)
+
+template<typename _Type, typename _Alloc>
+constexpr bool operator==(const Vector<_Type, _Alloc>& left, const Vector<_Type, _Alloc>& right) {
+    return comparison::rangesEqual(left.data(), left.size(), right.data(), right.size());
+}
+
+template<typename _Type, typename _Alloc>
+constexpr auto operator<=>(const Vector<_Type, _Alloc>& left, const Vector<_Type, _Alloc>& right) {
+    return comparison::rangesCompare(left.data(), left.size(), right.data(), right.size());
+}
+
+template<typename _Type, typename _Alloc>
+struct std::hash<Vector<_Type, _Alloc>> {
+    size_t operator()(const Vector<_Type, _Alloc>& vec) const {
+        return vec.hash();
+    }
+};
+
 #endif // !VECTOR_H
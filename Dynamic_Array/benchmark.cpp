@@ -0,0 +1,83 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <functional>
+
+#include "Vector.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const char* name, size_t bytes, double nanoseconds) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << bytes << " B"
+              << std::setw(12) << std::fixed << std::setprecision(1) << nanoseconds << " ns"
+              << std::setw(10) << std::setprecision(2) << bytes / nanoseconds << " GB/s" << std::endl;
+}
+
+template<typename T>
+bool loopEqual(const Vector<T>& left, const Vector<T>& right) {
+    if (left.size() != right.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < left.size(); i++) {
+        if (left[i] != right[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+bool loopLess(const Vector<T>& left, const Vector<T>& right) {
+    const size_t common = std::min(left.size(), right.size());
+    for (size_t i = 0; i < common; i++) {
+        if (left[i] != right[i]) {
+            return left[i] < right[i];
+        }
+    }
+
+    return left.size() < right.size();
+}
+
+template<typename T>
+uint64_t loopHash(const Vector<T>& vec) {
+    // the usual boost-style hash_combine over std::hash of every element
+    uint64_t seed = vec.size();
+    for (size_t i = 0; i < vec.size(); i++) {
+        seed ^= std::hash<T>{}(vec[i]) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+
+    return seed;
+}
+
+template<typename T>
+void benchmarkElementType(const char* typeName) {
+    std::cout << "\nVector<" << typeName << ">" << std::endl;
+
+    for (size_t bytes = 64; bytes <= (size_t(1) << 24); bytes *= 16) {
+        const size_t count = bytes / sizeof(T);
+        const size_t iterations = std::max<size_t>(8, (size_t(1) << 28) / bytes);
+
+        Vector<T> left(count, T(1));
+        Vector<T> right(count, T(1));
+        // differ only in the last element so every comparison scans the whole range
+        right[count - 1] = T(2);
+
+        printRow("loop operator==", bytes, measureNs(iterations, [&] { doNotOptimize(loopEqual(left, right)); }));
+        printRow("Vector operator==", bytes, measureNs(iterations, [&] { doNotOptimize(left == right); }));
+        printRow("loop operator<", bytes, measureNs(iterations, [&] { doNotOptimize(loopLess(left, right)); }));
+        printRow("Vector operator<=>", bytes, measureNs(iterations, [&] { doNotOptimize(left < right); }));
+        printRow("loop hash_combine", bytes, measureNs(iterations, [&] { doNotOptimize(loopHash(left)); }));
+        printRow("Vector::hash()", bytes, measureNs(iterations, [&] { doNotOptimize(left.hash()); }));
+    }
+}
+
+int main() {
+    std::cout << "VECTOR EQUALITY, ORDERING AND HASHING" << std::endl;
+
+    benchmarkElementType<uint8_t>("uint8_t");
+    benchmarkElementType<uint32_t>("uint32_t");
+    benchmarkElementType<uint64_t>("uint64_t");
+
+    return 0;
+}
@@ -0,0 +1,496 @@
+#ifndef INPLACERING_H
+#define INPLACERING_H
+
+#include <new>
+#include <memory>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+template<typename _Type, size_t _Capacity, bool _IsConst>
+class _InplaceRingIterator;
+
+// interface of fixed-capacity double-ended queue implemented as circular buffer with inline storage.
+// _Capacity is a power of two, so a slot index is the running position masked with _Capacity - 1
+// and neither end ever needs a wraparound branch. _front and _back run freely and only get masked on
+// access, hence size() is their difference. Slots are uninitialized until an element is pushed into
+// them and the ring never allocates. When _Type is trivially copyable so is the InplaceRing.
+
+template<typename _Type, size_t _Capacity>
+class InplaceRing {
+public:
+    static_assert(_Capacity > 0 && (_Capacity & (_Capacity - 1)) == 0,
+        "InplaceRing Error: Capacity must be a power of two!");
+
+    using value_type = _Type;
+    using size_type = size_t;
+    using reference = _Type&;
+    using const_reference = const _Type&;
+    using iterator = _InplaceRingIterator<_Type, _Capacity, false>;
+    using const_iterator = _InplaceRingIterator<_Type, _Capacity, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ctors
+    InplaceRing();
+
+    InplaceRing(std::initializer_list<_Type> initList);
+
+    InplaceRing(const InplaceRing& source) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceRing(const InplaceRing& source);
+
+    InplaceRing(InplaceRing&& source) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceRing(InplaceRing&& source);
+
+    // dtor
+    ~InplaceRing() requires std::is_trivially_destructible_v<_Type> = default;
+    ~InplaceRing();
+
+    // operator=
+    InplaceRing& operator=(const InplaceRing& right) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceRing& operator=(const InplaceRing& right);
+
+    InplaceRing& operator=(InplaceRing&& right) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceRing& operator=(InplaceRing&& right);
+
+    // element access
+    _Type& at(size_t pos);
+    const _Type& at(size_t pos) const;
+
+    _Type& operator[](size_t pos);
+    const _Type& operator[](size_t pos) const;
+
+    _Type& front();
+    const _Type& front() const;
+
+    _Type& back();
+    const _Type& back() const;
+
+    // iterators
+    iterator begin();
+    const_iterator cbegin() const;
+
+    iterator end();
+    const_iterator cend() const;
+
+    reverse_iterator rbegin();
+    const_reverse_iterator crbegin() const;
+
+    reverse_iterator rend();
+    const_reverse_iterator crend() const;
+
+    // capacity
+    bool empty() const;
+
+    bool full() const;
+
+    size_t size() const;
+
+    static constexpr size_t capacity();
+
+    // modifiers
+    void clear();
+
+    void push_back(const _Type& value);
+    void push_back(_Type&& value);
+
+    template<typename... Args>
+    _Type& emplace_back(Args&&... args);
+
+    void pop_back();
+
+    void push_front(const _Type& value);
+    void push_front(_Type&& value);
+
+    template<typename... Args>
+    _Type& emplace_front(Args&&... args);
+
+    void pop_front();
+
+    void swap(InplaceRing& other);
+
+private:
+    static constexpr size_t _mask = _Capacity - 1;
+
+    _Type* _slot(size_t position);
+    const _Type* _slot(size_t position) const;
+
+    void _checkForRoom() const;
+
+    template<typename _Source>
+    void _appendFrom(_Source&& source);
+
+private:
+    size_t _front; // running position of the front element
+    size_t _back; // running position one past the back element
+    alignas(_Type) unsigned char _storage[_Capacity * sizeof(_Type)]; // raw slots
+};
+
+// InplaceRing definition
+
+template<typename _Type, size_t _Capacity>
+_Type* InplaceRing<_Type, _Capacity>::_slot(size_t position) {
+    return std::launder(reinterpret_cast<_Type*>(_storage)) + (position & _mask);
+}
+
+template<typename _Type, size_t _Capacity>
+const _Type* InplaceRing<_Type, _Capacity>::_slot(size_t position) const {
+    return std::launder(reinterpret_cast<const _Type*>(_storage)) + (position & _mask);
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::_checkForRoom() const {
+    if (full()) {
+        throw std::length_error("InplaceRing Error: Ring is full!");
+    }
+}
+
+template<typename _Type, size_t _Capacity>
+template<typename _Source>
+void InplaceRing<_Type, _Capacity>::_appendFrom(_Source&& source) {
+    for (size_t pos = source._front; pos != source._back; pos++) {
+        if constexpr (std::is_lvalue_reference_v<_Source>) {
+            emplace_back(*source._slot(pos));
+        } else {
+            emplace_back(std::move(*source._slot(pos)));
+        }
+    }
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>::InplaceRing() : _front(0), _back(0) {}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>::InplaceRing(std::initializer_list<_Type> initList) : _front(0), _back(0) {
+    if (initList.size() > _Capacity) {
+        throw std::length_error("InplaceRing Error: Ring is full!");
+    }
+
+    for (const _Type& value : initList) {
+        emplace_back(value);
+    }
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>::InplaceRing(const InplaceRing& source) : _front(0), _back(0) {
+    _appendFrom(source);
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>::InplaceRing(InplaceRing&& source) : _front(0), _back(0) {
+    // the storage is inline, so moving is element-wise; the source keeps its moved-from elements
+    _appendFrom(std::move(source));
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>::~InplaceRing() {
+    clear();
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>& InplaceRing<_Type, _Capacity>::operator=(const InplaceRing& right) {
+    if (this != &right) {
+        clear();
+        _appendFrom(right);
+    }
+
+    return *this;
+}
+
+template<typename _Type, size_t _Capacity>
+InplaceRing<_Type, _Capacity>& InplaceRing<_Type, _Capacity>::operator=(InplaceRing&& right) {
+    if (this != &right) {
+        clear();
+        _appendFrom(std::move(right));
+    }
+
+    return *this;
+}
+
+template<typename _Type, size_t _Capacity>
+_Type& InplaceRing<_Type, _Capacity>::at(size_t pos) {
+    if (pos >= size()) {
+        throw std::out_of_range("InplaceRing Error: Index out of bounds!");
+    }
+
+    return *_slot(_front + pos);
+}
+
+template<typename _Type, size_t _Capacity>
+const _Type& InplaceRing<_Type, _Capacity>::at(size_t pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("InplaceRing Error: Index out of bounds!");
+    }
+
+    return *_slot(_front + pos);
+}
+
+template<typename _Type, size_t _Capacity>
+_Type& InplaceRing<_Type, _Capacity>::operator[](size_t pos) {
+    return *_slot(_front + pos);
+}
+
+template<typename _Type, size_t _Capacity>
+const _Type& InplaceRing<_Type, _Capacity>::operator[](size_t pos) const {
+    return *_slot(_front + pos);
+}
+
+template<typename _Type, size_t _Capacity>
+_Type& InplaceRing<_Type, _Capacity>::front() {
+    return *_slot(_front);
+}
+
+template<typename _Type, size_t _Capacity>
+const _Type& InplaceRing<_Type, _Capacity>::front() const {
+    return *_slot(_front);
+}
+
+template<typename _Type, size_t _Capacity>
+_Type& InplaceRing<_Type, _Capacity>::back() {
+    return *_slot(_back - 1);
+}
+
+template<typename _Type, size_t _Capacity>
+const _Type& InplaceRing<_Type, _Capacity>::back() const {
+    return *_slot(_back - 1);
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::iterator InplaceRing<_Type, _Capacity>::begin() {
+    return iterator(reinterpret_cast<_Type*>(_storage), _front);
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::const_iterator InplaceRing<_Type, _Capacity>::cbegin() const {
+    return const_iterator(reinterpret_cast<const _Type*>(_storage), _front);
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::iterator InplaceRing<_Type, _Capacity>::end() {
+    return iterator(reinterpret_cast<_Type*>(_storage), _back);
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::const_iterator InplaceRing<_Type, _Capacity>::cend() const {
+    return const_iterator(reinterpret_cast<const _Type*>(_storage), _back);
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::reverse_iterator InplaceRing<_Type, _Capacity>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::const_reverse_iterator InplaceRing<_Type, _Capacity>::crbegin() const {
+    return const_reverse_iterator(cend());
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::reverse_iterator InplaceRing<_Type, _Capacity>::rend() {
+    return reverse_iterator(begin());
+}
+
+template<typename _Type, size_t _Capacity>
+typename InplaceRing<_Type, _Capacity>::const_reverse_iterator InplaceRing<_Type, _Capacity>::crend() const {
+    return const_reverse_iterator(cbegin());
+}
+
+template<typename _Type, size_t _Capacity>
+bool InplaceRing<_Type, _Capacity>::empty() const {
+    return _front == _back;
+}
+
+template<typename _Type, size_t _Capacity>
+bool InplaceRing<_Type, _Capacity>::full() const {
+    return size() == _Capacity;
+}
+
+template<typename _Type, size_t _Capacity>
+size_t InplaceRing<_Type, _Capacity>::size() const {
+    return _back - _front;
+}
+
+template<typename _Type, size_t _Capacity>
+constexpr size_t InplaceRing<_Type, _Capacity>::capacity() {
+    return _Capacity;
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<_Type>) {
+        for (size_t pos = _front; pos != _back; pos++) {
+            _slot(pos)->~_Type();
+        }
+    }
+
+    _front = _back = 0;
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::push_back(const _Type& value) {
+    emplace_back(value);
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::push_back(_Type&& value) {
+    emplace_back(std::move(value));
+}
+
+template<typename _Type, size_t _Capacity>
+template<typename... Args>
+_Type& InplaceRing<_Type, _Capacity>::emplace_back(Args&&... args) {
+    _checkForRoom();
+
+    _Type* element = ::new(static_cast<void*>(_slot(_back))) _Type(std::forward<Args>(args)...);
+    _back++;
+
+    return *element;
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::pop_back() {
+    assert(!empty() && "InplaceRing Error: pop_back() called on empty ring!");
+
+    _back--;
+    _slot(_back)->~_Type();
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::push_front(const _Type& value) {
+    emplace_front(value);
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::push_front(_Type&& value) {
+    emplace_front(std::move(value));
+}
+
+template<typename _Type, size_t _Capacity>
+template<typename... Args>
+_Type& InplaceRing<_Type, _Capacity>::emplace_front(Args&&... args) {
+    _checkForRoom();
+
+    // _front may step below zero; unsigned wraparound keeps _back - _front and the masked slot right
+    _Type* element = ::new(static_cast<void*>(_slot(_front - 1))) _Type(std::forward<Args>(args)...);
+    _front--;
+
+    return *element;
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::pop_front() {
+    assert(!empty() && "InplaceRing Error: pop_front() called on empty ring!");
+
+    _slot(_front)->~_Type();
+    _front++;
+}
+
+template<typename _Type, size_t _Capacity>
+void InplaceRing<_Type, _Capacity>::swap(InplaceRing& other) {
+    if (this != &other) {
+        InplaceRing tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+}
+
+// definition of random access iterator over the running positions of the ring
+
+template<typename _Type, size_t _Capacity, bool _IsConst>
+class _InplaceRingIterator {
+private:
+    using _SlotPtr = std::conditional_t<_IsConst, const _Type*, _Type*>;
+
+public:
+    using _Self = _InplaceRingIterator<_Type, _Capacity, _IsConst>;
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = _Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<_IsConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<_IsConst, const value_type&, value_type&>;
+
+    // ctors
+    _InplaceRingIterator() : _slots(nullptr), _position(0) {}
+
+    _InplaceRingIterator(_SlotPtr slots, size_t position) : _slots(slots), _position(position) {}
+
+    // operator overloads
+    bool operator==(const _Self& right) const {
+        return _position == right._position;
+    }
+
+    auto operator<=>(const _Self& right) const {
+        return static_cast<difference_type>(_position - right._position) <=> 0;
+    }
+
+    reference operator*() const {
+        return *std::launder(_slots + (_position & (_Capacity - 1)));
+    }
+
+    pointer operator->() const {
+        return std::launder(_slots + (_position & (_Capacity - 1)));
+    }
+
+    reference operator[](difference_type off) const {
+        return *(*this + off);
+    }
+
+    // iterator increment and decrement
+    _Self& operator++() { // prefix
+        ++_position;
+        return *this;
+    }
+
+    _Self operator++(int) { // postfix
+        _Self tmp = *this;
+        ++_position;
+        return tmp;
+    }
+
+    _Self& operator--() { // prefix
+        --_position;
+        return *this;
+    }
+
+    _Self operator--(int) { // postfix
+        _Self tmp = *this;
+        --_position;
+        return tmp;
+    }
+
+    // pointer arithmetic
+    _Self& operator+=(difference_type off) {
+        _position += off;
+        return *this;
+    }
+
+    _Self operator+(difference_type off) const {
+        return _Self(_slots, _position + off);
+    }
+
+    friend _Self operator+(difference_type off, const _Self& it) {
+        return it + off;
+    }
+
+    _Self& operator-=(difference_type off) {
+        _position -= off;
+        return *this;
+    }
+
+    _Self operator-(difference_type off) const {
+        return _Self(_slots, _position - off);
+    }
+
+    difference_type operator-(const _Self& right) const {
+        return static_cast<difference_type>(_position - right._position);
+    }
+
+private:
+    _SlotPtr _slots; // the first slot of the ring storage
+    size_t _position; // running position, masked on dereference
+};
+
+#endif // !INPLACERING_H
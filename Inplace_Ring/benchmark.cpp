@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+
+#include "InplaceRing.h"
+#include "../Double_Ended_Queue/Deque.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const char* name, size_t depth, double nanoseconds) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::setw(6) << depth << " deep"
+              << std::setw(10) << std::fixed << std::setprecision(2) << nanoseconds << " ns/op" << std::endl;
+}
+
+constexpr size_t RING_CAPACITY = 1024;
+constexpr size_t OPERATIONS = 1 << 20;
+
+// steady-state FIFO: a queue held at depth elements, every operation pushes one and pops one
+template<typename _Queue>
+double fifoChurn(_Queue& queue, size_t depth) {
+    for (size_t i = 0; i < depth; i++) {
+        queue.push_back(i);
+    }
+
+    uint64_t value = depth;
+    uint64_t checksum = 0;
+    const double ns = measureNs(OPERATIONS, [&] {
+        queue.push_back(value++);
+        checksum += queue.front();
+        queue.pop_front();
+    });
+    doNotOptimize(checksum);
+
+    return ns;
+}
+
+// bursts: fill the queue to depth elements, then drain it; reported per element
+template<typename _Queue>
+double burstChurn(_Queue& queue, size_t depth) {
+    uint64_t checksum = 0;
+    const double ns = measureNs(OPERATIONS / depth, [&] {
+        for (size_t i = 0; i < depth; i++) {
+            queue.push_back(i);
+        }
+        while (!queue.empty()) {
+            checksum += queue.front();
+            queue.pop_front();
+        }
+    });
+    doNotOptimize(checksum);
+
+    return ns / depth;
+}
+
+int main() {
+    std::cout << "QUEUE CHURN, " << OPERATIONS << " operations (InplaceRing capacity " << RING_CAPACITY << ")\n" << std::endl;
+
+    for (size_t depth : { 4, 64, 512 }) {
+        {
+            InplaceRing<uint64_t, RING_CAPACITY> ring;
+            printRow("InplaceRing FIFO push/pop", depth, fifoChurn(ring, depth));
+        }
+        {
+            Deque<uint64_t> deque;
+            printRow("ring Deque FIFO push/pop", depth, fifoChurn(deque, depth));
+        }
+        {
+            InplaceRing<uint64_t, RING_CAPACITY> ring;
+            printRow("InplaceRing fill/drain bursts", depth, burstChurn(ring, depth));
+        }
+        {
+            Deque<uint64_t> deque;
+            printRow("ring Deque fill/drain bursts", depth, burstChurn(deque, depth));
+        }
+        std::cout << std::endl;
+    }
+
+    // per-connection lifetime: construct a queue, pass a few messages through it, destroy it
+    std::cout << "CONSTRUCT, 8 MESSAGES, DESTROY\n" << std::endl;
+    {
+        uint64_t checksum = 0;
+        double ns = measureNs(OPERATIONS / 8, [&] {
+            InplaceRing<uint64_t, 16> ring;
+            for (uint64_t i = 0; i < 8; i++) {
+                ring.push_back(i);
+            }
+            while (!ring.empty()) {
+                checksum += ring.front();
+                ring.pop_front();
+            }
+            doNotOptimize(ring);
+        });
+        printRow("InplaceRing<uint64_t, 16>", 8, ns);
+
+        ns = measureNs(OPERATIONS / 8, [&] {
+            Deque<uint64_t> deque;
+            for (uint64_t i = 0; i < 8; i++) {
+                deque.push_back(i);
+            }
+            while (!deque.empty()) {
+                checksum += deque.front();
+                deque.pop_front();
+            }
+            doNotOptimize(deque);
+        });
+        printRow("ring Deque<uint64_t>", 8, ns);
+        doNotOptimize(checksum);
+    }
+
+    return 0;
+}
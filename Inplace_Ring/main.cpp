@@ -0,0 +1,104 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <type_traits>
+
+#include "InplaceRing.h"
+
+static_assert(std::is_trivially_copyable_v<InplaceRing<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<InplaceRing<std::string, 8>>);
+
+template<typename _Container>
+void printContainer(std::ofstream& file, const _Container& container) {
+    file << "size = " << container.size() << ", capacity = " << container.capacity() << ": ";
+    for (auto it = container.cbegin(); it != container.cend(); ++it) {
+        file << *it << " ";
+    }
+    file << std::endl;
+}
+
+int main() {
+    std::ofstream myInplaceRingTestFile("InplaceRingTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myInplaceRingTestFile << "INPLACE RING\n" << std::endl;
+
+    // push and pop at both ends, wrapping around the storage
+    {
+        InplaceRing<int, 8> ring = { 3, 4, 5 };
+        printContainer(myInplaceRingTestFile, ring);
+
+        ring.push_front(2);
+        ring.push_front(1);
+        ring.emplace_back(6);
+        myInplaceRingTestFile << "after push_front(2), push_front(1), emplace_back(6) -> ";
+        printContainer(myInplaceRingTestFile, ring);
+
+        for (int i = 7; i < 20; i++) {
+            ring.pop_front();
+            ring.push_back(i);
+        }
+        myInplaceRingTestFile << "after 13 pop_front/push_back rounds -> ";
+        printContainer(myInplaceRingTestFile, ring);
+
+        ring.pop_back();
+        myInplaceRingTestFile << "after pop_back -> ";
+        printContainer(myInplaceRingTestFile, ring);
+
+        myInplaceRingTestFile << "front() = " << ring.front() << ", back() = " << ring.back()
+                              << ", ring[2] = " << ring[2] << std::endl;
+
+        try {
+            ring.at(ring.size());
+        } catch (const std::out_of_range& error) {
+            myInplaceRingTestFile << "at(size()) threw: " << error.what() << std::endl;
+        }
+    }
+
+    // random access iterators
+    {
+        InplaceRing<int, 8> ring;
+        for (int value : { 5, 1, 4, 2, 3 }) {
+            ring.push_front(value);
+        }
+        std::sort(ring.begin(), ring.end());
+
+        myInplaceRingTestFile << "\nsorted through random access iterators -> ";
+        printContainer(myInplaceRingTestFile, ring);
+
+        myInplaceRingTestFile << "in reverse: ";
+        for (auto it = ring.crbegin(); it != ring.crend(); ++it) {
+            myInplaceRingTestFile << *it << " ";
+        }
+        myInplaceRingTestFile << std::endl;
+    }
+
+    // non-trivial elements, copying and overflow
+    {
+        InplaceRing<std::string, 4> words = { "one", "two", "three" };
+        words.push_front("zero");
+
+        InplaceRing<std::string, 4> copy = words;
+        copy.pop_front();
+        copy.push_back("four");
+
+        myInplaceRingTestFile << "\nwords -> ";
+        printContainer(myInplaceRingTestFile, words);
+        myInplaceRingTestFile << "copy -> ";
+        printContainer(myInplaceRingTestFile, copy);
+
+        words.swap(copy);
+        myInplaceRingTestFile << "after swap, words -> ";
+        printContainer(myInplaceRingTestFile, words);
+
+        try {
+            words.push_back("five");
+        } catch (const std::length_error& error) {
+            myInplaceRingTestFile << "push_back on a full ring threw: " << error.what() << std::endl;
+        }
+    }
+
+    myInplaceRingTestFile.close();
+
+    return 0;
+}
@@ -0,0 +1,548 @@
+#ifndef INPLACEVECTOR_H
+#define INPLACEVECTOR_H
+
+#include <new>
+#include <memory>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Utility/Compare.h"
+
+// what a modifier does when the requested elements do not fit into the fixed capacity
+enum class OverflowPolicy {
+    Throw,      // throws std::length_error
+    Error,      // leaves the container unchanged and reports the failure through its return value
+    Unchecked   // assumes the elements fit: asserts in debug builds, no check at all with NDEBUG
+};
+
+// interface of a dynamically-sized Vector with a fixed capacity and inline (never heap-allocated) storage.
+// Elements live in an uninitialized buffer of _Capacity slots and are constructed only when added.
+// When _Type is trivially copyable so is the InplaceVector, which can then be copied with memcpy.
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow = OverflowPolicy::Throw>
+class InplaceVector {
+private:
+    static constexpr bool _reportsErrors = _Overflow == OverflowPolicy::Error;
+
+public:
+    using value_type = _Type;
+    using size_type = size_t;
+    using reference = _Type&;
+    using const_reference = const _Type&;
+    using iterator = _Type*;
+    using const_iterator = const _Type*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // with OverflowPolicy::Error: false, nullptr iterator and nullptr element on overflow
+    using status_type = std::conditional_t<_reportsErrors, bool, void>;
+    using emplace_type = std::conditional_t<_reportsErrors, _Type*, _Type&>;
+
+    // ctors (the sized ones apply the overflow policy too, only OverflowPolicy::Error leaves them empty)
+    InplaceVector();
+
+    explicit InplaceVector(size_t size);
+    InplaceVector(size_t size, const _Type& initValue);
+
+    InplaceVector(std::initializer_list<_Type> initList);
+
+    InplaceVector(const InplaceVector& source) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceVector(const InplaceVector& source);
+
+    InplaceVector(InplaceVector&& source) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceVector(InplaceVector&& source);
+
+    // dtor
+    ~InplaceVector() requires std::is_trivially_destructible_v<_Type> = default;
+    ~InplaceVector();
+
+    // operator=
+    InplaceVector& operator=(const InplaceVector& right) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceVector& operator=(const InplaceVector& right);
+
+    InplaceVector& operator=(InplaceVector&& right) requires std::is_trivially_copyable_v<_Type> = default;
+    InplaceVector& operator=(InplaceVector&& right);
+
+    // element access
+    _Type& at(size_t idx);
+    const _Type& at(size_t idx) const;
+
+    _Type& operator[](size_t idx);
+    const _Type& operator[](size_t idx) const;
+
+    _Type& front();
+    const _Type& front() const;
+
+    _Type& back();
+    const _Type& back() const;
+
+    _Type* data();
+    const _Type* data() const;
+
+    // iterators
+    iterator begin() {
+        return data();
+    }
+
+    const_iterator cbegin() const {
+        return data();
+    }
+
+    iterator end() {
+        return data() + _size;
+    }
+
+    const_iterator cend() const {
+        return data() + _size;
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const {
+        return const_reverse_iterator(cend());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const {
+        return const_reverse_iterator(cbegin());
+    }
+
+    // capacity
+    bool empty() const;
+
+    bool full() const;
+
+    size_t size() const;
+
+    static constexpr size_t capacity();
+
+    // modifiers
+    void clear();
+
+    iterator insert(const_iterator pos, const _Type& value);
+    iterator insert(const_iterator pos, _Type&& value);
+
+    iterator insert(const_iterator pos, size_t count, const _Type& value);
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    status_type push_back(const _Type& value);
+    status_type push_back(_Type&& value);
+
+    template<typename... Args>
+    emplace_type emplace_back(Args&&... args);
+
+    void pop_back();
+
+    // copies [first, last) to the end after a single capacity check
+    template<typename ForwardIt>
+    status_type append(ForwardIt first, ForwardIt last);
+
+    status_type resize(size_t newSize);
+    status_type resize(size_t newSize, const _Type& value);
+
+    void swap(InplaceVector& other);
+
+private:
+    bool _fits(size_t count) const;
+
+    void _destroyFrom(size_t first);
+
+    template<typename... Args>
+    void _constructAt(size_t idx, Args&&... args);
+
+private:
+    size_t _size; // the number of constructed elements, always the first _size slots
+    alignas(_Type) unsigned char _storage[(_Capacity == 0 ? 1 : _Capacity) * sizeof(_Type)]; // raw slots
+};
+
+// InplaceVector definition
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+bool InplaceVector<_Type, _Capacity, _Overflow>::_fits(size_t count) const {
+    const bool fits = count <= _Capacity - _size;
+
+    if constexpr (_Overflow == OverflowPolicy::Throw) {
+        if (!fits) {
+            throw std::length_error("InplaceVector Error: Capacity exceeded!");
+        }
+    } else if constexpr (_Overflow == OverflowPolicy::Unchecked) {
+        assert(fits && "InplaceVector Error: Capacity exceeded!");
+        return true;
+    }
+
+    return fits;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+void InplaceVector<_Type, _Capacity, _Overflow>::_destroyFrom(size_t first) {
+    // calls the destructor of each element in reverse order
+    for (size_t i = _size; i > first; i--) {
+        data()[i - 1].~_Type();
+    }
+
+    _size = first;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+template<typename... Args>
+void InplaceVector<_Type, _Capacity, _Overflow>::_constructAt(size_t idx, Args&&... args) {
+    ::new(static_cast<void*>(data() + idx)) _Type(std::forward<Args>(args)...);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector() : _size(0) {}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector(size_t size) : _size(0) {
+    resize(size);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector(size_t size, const _Type& initValue) : _size(0) {
+    resize(size, initValue);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector(std::initializer_list<_Type> initList) : _size(0) {
+    if (_fits(initList.size())) {
+        for (const _Type& value : initList) {
+            _constructAt(_size++, value);
+        }
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector(const InplaceVector& source) : _size(0) {
+    for (; _size < source._size; _size++) {
+        _constructAt(_size, source[_size]);
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::InplaceVector(InplaceVector&& source) : _size(0) {
+    // the storage is inline, so moving is element-wise; the source keeps its moved-from elements
+    for (; _size < source._size; _size++) {
+        _constructAt(_size, std::move(source[_size]));
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>::~InplaceVector() {
+    clear();
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>& InplaceVector<_Type, _Capacity, _Overflow>::operator=(const InplaceVector& right) {
+    if (this != &right) {
+        const size_t common = std::min(_size, right._size);
+        std::copy(right.data(), right.data() + common, data());
+
+        for (; _size < right._size; _size++) {
+            _constructAt(_size, right[_size]);
+        }
+        _destroyFrom(right._size);
+    }
+
+    return *this;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+InplaceVector<_Type, _Capacity, _Overflow>& InplaceVector<_Type, _Capacity, _Overflow>::operator=(InplaceVector&& right) {
+    if (this != &right) {
+        const size_t common = std::min(_size, right._size);
+        std::move(right.data(), right.data() + common, data());
+
+        for (; _size < right._size; _size++) {
+            _constructAt(_size, std::move(right[_size]));
+        }
+        _destroyFrom(right._size);
+    }
+
+    return *this;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+_Type& InplaceVector<_Type, _Capacity, _Overflow>::at(size_t idx) {
+    if (idx >= size()) {
+        throw std::out_of_range("InplaceVector Error: Index out of bounds!");
+    }
+
+    return data()[idx];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+const _Type& InplaceVector<_Type, _Capacity, _Overflow>::at(size_t idx) const {
+    if (idx >= size()) {
+        throw std::out_of_range("InplaceVector Error: Index out of bounds!");
+    }
+
+    return data()[idx];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+_Type& InplaceVector<_Type, _Capacity, _Overflow>::operator[](size_t idx) {
+    return data()[idx];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+const _Type& InplaceVector<_Type, _Capacity, _Overflow>::operator[](size_t idx) const {
+    return data()[idx];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+_Type& InplaceVector<_Type, _Capacity, _Overflow>::front() {
+    return data()[0];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+const _Type& InplaceVector<_Type, _Capacity, _Overflow>::front() const {
+    return data()[0];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+_Type& InplaceVector<_Type, _Capacity, _Overflow>::back() {
+    return data()[_size - 1];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+const _Type& InplaceVector<_Type, _Capacity, _Overflow>::back() const {
+    return data()[_size - 1];
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+_Type* InplaceVector<_Type, _Capacity, _Overflow>::data() {
+    return std::launder(reinterpret_cast<_Type*>(_storage));
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+const _Type* InplaceVector<_Type, _Capacity, _Overflow>::data() const {
+    return std::launder(reinterpret_cast<const _Type*>(_storage));
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+bool InplaceVector<_Type, _Capacity, _Overflow>::empty() const {
+    return _size == 0;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+bool InplaceVector<_Type, _Capacity, _Overflow>::full() const {
+    return _size == _Capacity;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+size_t InplaceVector<_Type, _Capacity, _Overflow>::size() const {
+    return _size;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+constexpr size_t InplaceVector<_Type, _Capacity, _Overflow>::capacity() {
+    return _Capacity;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+void InplaceVector<_Type, _Capacity, _Overflow>::clear() {
+    _destroyFrom(0);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::insert(const_iterator pos, const _Type& value) {
+    return emplace(pos, value);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::insert(const_iterator pos, _Type&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::insert(const_iterator pos, size_t count, const _Type& value) {
+    const size_t distance = pos - cbegin();
+
+    if (!_fits(count)) {
+        return nullptr;
+    }
+
+    // append the new elements, then rotate them into place
+    const size_t oldSize = _size;
+    for (size_t i = 0; i < count; i++) {
+        _constructAt(_size++, value);
+    }
+    std::rotate(begin() + distance, begin() + oldSize, end());
+
+    return begin() + distance;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+template<typename... Args>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::emplace(const_iterator pos, Args&&... args) {
+    const size_t distance = pos - cbegin();
+
+    if (!_fits(1)) {
+        return nullptr;
+    }
+
+    _constructAt(_size++, std::forward<Args>(args)...);
+    std::rotate(begin() + distance, end() - 1, end());
+
+    return begin() + distance;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::erase(const_iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::iterator InplaceVector<_Type, _Capacity, _Overflow>::erase(const_iterator first, const_iterator last) {
+    const size_t start = first - cbegin();
+    const size_t distance = last - first;
+    if (distance == 0) {
+        // the move below would assign every element after start to itself
+        return begin() + start;
+    }
+
+    std::move(begin() + start + distance, end(), begin() + start);
+    _destroyFrom(_size - distance);
+
+    return begin() + start;
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::status_type InplaceVector<_Type, _Capacity, _Overflow>::push_back(const _Type& value) {
+    if constexpr (_reportsErrors) {
+        return emplace_back(value) != nullptr;
+    } else {
+        emplace_back(value);
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::status_type InplaceVector<_Type, _Capacity, _Overflow>::push_back(_Type&& value) {
+    if constexpr (_reportsErrors) {
+        return emplace_back(std::move(value)) != nullptr;
+    } else {
+        emplace_back(std::move(value));
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+template<typename... Args>
+typename InplaceVector<_Type, _Capacity, _Overflow>::emplace_type InplaceVector<_Type, _Capacity, _Overflow>::emplace_back(Args&&... args) {
+    if constexpr (_reportsErrors) {
+        if (!_fits(1)) {
+            return nullptr;
+        }
+
+        _constructAt(_size, std::forward<Args>(args)...);
+        return data() + _size++;
+    } else {
+        _fits(1);
+
+        _constructAt(_size, std::forward<Args>(args)...);
+        return data()[_size++];
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+void InplaceVector<_Type, _Capacity, _Overflow>::pop_back() {
+    if (_size > 0) {
+        _destroyFrom(_size - 1);
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+template<typename ForwardIt>
+typename InplaceVector<_Type, _Capacity, _Overflow>::status_type InplaceVector<_Type, _Capacity, _Overflow>::append(ForwardIt first, ForwardIt last) {
+    if (_fits(std::distance(first, last))) {
+        for (; first != last; ++first) {
+            _constructAt(_size++, *first);
+        }
+    } else if constexpr (_reportsErrors) {
+        return false;
+    }
+
+    if constexpr (_reportsErrors) {
+        return true;
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::status_type InplaceVector<_Type, _Capacity, _Overflow>::resize(size_t newSize) {
+    if (newSize <= _size) {
+        _destroyFrom(newSize);
+    } else if (_fits(newSize - _size)) {
+        while (_size < newSize) {
+            _constructAt(_size++);
+        }
+    } else if constexpr (_reportsErrors) {
+        return false;
+    }
+
+    if constexpr (_reportsErrors) {
+        return true;
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+typename InplaceVector<_Type, _Capacity, _Overflow>::status_type InplaceVector<_Type, _Capacity, _Overflow>::resize(size_t newSize, const _Type& value) {
+    if (newSize <= _size) {
+        _destroyFrom(newSize);
+    } else if (_fits(newSize - _size)) {
+        while (_size < newSize) {
+            _constructAt(_size++, value);
+        }
+    } else if constexpr (_reportsErrors) {
+        return false;
+    }
+
+    if constexpr (_reportsErrors) {
+        return true;
+    }
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+void InplaceVector<_Type, _Capacity, _Overflow>::swap(InplaceVector& other) {
+    if (this != &other) {
+        InplaceVector& shorter = _size < other._size ? *this : other;
+        InplaceVector& longer = _size < other._size ? other : *this;
+
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+
+        // move the tail of the longer one across
+        for (size_t i = shorter._size; i < longer._size; i++) {
+            shorter._constructAt(i, std::move(longer[i]));
+        }
+
+        const size_t shorterSize = shorter._size;
+        shorter._size = longer._size;
+        longer._destroyFrom(shorterSize);
+    }
+}
+
+// non-member comparison operators
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+bool operator==(const InplaceVector<_Type, _Capacity, _Overflow>& left, const InplaceVector<_Type, _Capacity, _Overflow>& right) {
+    return comparison::rangesEqual(left.data(), left.size(), right.data(), right.size());
+}
+
+template<typename _Type, size_t _Capacity, OverflowPolicy _Overflow>
+auto operator<=>(const InplaceVector<_Type, _Capacity, _Overflow>& left, const InplaceVector<_Type, _Capacity, _Overflow>& right) {
+    return comparison::rangesCompare(left.data(), left.size(), right.data(), right.size());
+}
+
+#endif // !INPLACEVECTOR_H
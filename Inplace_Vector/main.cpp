@@ -0,0 +1,130 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+#include "InplaceVector.h"
+
+struct PacketHeader {
+    uint16_t _port;
+    uint16_t _length;
+};
+
+// trivially copyable elements keep the whole container trivially copyable
+static_assert(std::is_trivially_copyable_v<InplaceVector<PacketHeader, 8>>);
+static_assert(std::is_trivially_copyable_v<InplaceVector<int, 16, OverflowPolicy::Error>>);
+static_assert(!std::is_trivially_copyable_v<InplaceVector<std::string, 4>>);
+
+template<typename _Container>
+void printContainer(std::ofstream& file, const _Container& container) {
+    file << "size = " << container.size() << ", capacity = " << container.capacity() << ": ";
+    for (auto it = container.cbegin(); it != container.cend(); ++it) {
+        file << *it << " ";
+    }
+    file << std::endl;
+}
+
+int main() {
+    std::ofstream myInplaceVectorTestFile("InplaceVectorTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myInplaceVectorTestFile << "INPLACE VECTOR MODIFIERS\n" << std::endl;
+
+    // the Vector modifier API
+    {
+        InplaceVector<std::string, 8> words = { "alpha", "gamma", "delta" };
+        printContainer(myInplaceVectorTestFile, words);
+
+        words.insert(words.cbegin() + 1, "beta");
+        words.emplace_back(3, 'z');
+        words.push_back("omega");
+        myInplaceVectorTestFile << "after insert, emplace_back and push_back -> ";
+        printContainer(myInplaceVectorTestFile, words);
+
+        words.erase(words.cbegin() + 3);
+        words.pop_back();
+        myInplaceVectorTestFile << "after erase and pop_back -> ";
+        printContainer(myInplaceVectorTestFile, words);
+
+        words.insert(words.cbegin(), 2, "x");
+        myInplaceVectorTestFile << "after insert(begin, 2, \"x\") -> ";
+        printContainer(myInplaceVectorTestFile, words);
+
+        words.resize(3);
+        myInplaceVectorTestFile << "after resize(3) -> ";
+        printContainer(myInplaceVectorTestFile, words);
+
+        InplaceVector<std::string, 8> other = { "one", "two", "three", "four", "five" };
+        words.swap(other);
+        myInplaceVectorTestFile << "after swap -> ";
+        printContainer(myInplaceVectorTestFile, words);
+        printContainer(myInplaceVectorTestFile, other);
+
+        InplaceVector<std::string, 8> copy = words;
+        myInplaceVectorTestFile << "copy == words: " << std::boolalpha << (copy == words) << std::endl;
+
+        words.erase(words.cbegin() + 1, words.cbegin() + 1);
+        myInplaceVectorTestFile << "after erase of the empty range [1, 1) -> ";
+        printContainer(myInplaceVectorTestFile, words);
+    }
+
+    myInplaceVectorTestFile << "\nOVERFLOW POLICIES\n" << std::endl;
+
+    // OverflowPolicy::Throw
+    {
+        InplaceVector<int, 4> numbers(4, 7);
+        printContainer(myInplaceVectorTestFile, numbers);
+
+        try {
+            numbers.push_back(8);
+        } catch (const std::length_error& error) {
+            myInplaceVectorTestFile << "push_back on a full InplaceVector threw: " << error.what() << std::endl;
+        }
+    }
+
+    // OverflowPolicy::Error
+    {
+        InplaceVector<int, 4, OverflowPolicy::Error> numbers = { 1, 2, 3 };
+
+        myInplaceVectorTestFile << "push_back(4) returned " << numbers.push_back(4) << std::endl;
+        myInplaceVectorTestFile << "push_back(5) returned " << numbers.push_back(5) << std::endl;
+        myInplaceVectorTestFile << "emplace_back(6) returned nullptr: " << (numbers.emplace_back(6) == nullptr) << std::endl;
+        myInplaceVectorTestFile << "insert(begin, 0) returned nullptr: " << (numbers.insert(numbers.cbegin(), 0) == nullptr) << std::endl;
+        myInplaceVectorTestFile << "resize(6) returned " << numbers.resize(6) << std::endl;
+        printContainer(myInplaceVectorTestFile, numbers);
+    }
+
+    // OverflowPolicy::Unchecked
+    {
+        InplaceVector<int, 4, OverflowPolicy::Unchecked> numbers;
+        for (int i = 0; i < 4; i++) {
+            numbers.emplace_back(i * i);
+        }
+        printContainer(myInplaceVectorTestFile, numbers);
+    }
+
+    myInplaceVectorTestFile << "\nTRIVIAL COPY INTO A FRAME\n" << std::endl;
+
+    // a trivially copyable InplaceVector can be written to and read back from raw bytes
+    {
+        InplaceVector<PacketHeader, 8> headers;
+        headers.push_back({ 80, 512 });
+        headers.push_back({ 443, 1400 });
+
+        unsigned char frame[sizeof(headers)];
+        std::memcpy(frame, &headers, sizeof(headers));
+
+        InplaceVector<PacketHeader, 8> received;
+        std::memcpy(&received, frame, sizeof(received));
+
+        myInplaceVectorTestFile << "sizeof(InplaceVector<PacketHeader, 8>) = " << sizeof(headers) << std::endl;
+        for (const PacketHeader& header : received) {
+            myInplaceVectorTestFile << "port " << header._port << ", length " << header._length << std::endl;
+        }
+    }
+
+    myInplaceVectorTestFile.close();
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+#ifndef MAGICRINGBUFFER_H
+#define MAGICRINGBUFFER_H
+
+#include <span>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace constants {
+    constexpr size_t _magicRingGrowthFactor = 2;
+}
+
+// interface of a ring buffer whose contents are always contiguous in memory (Linux only).
+// The storage is a memfd_create() region mapped twice, back to back, so the byte after the end of the
+// first view is the first byte of the region again. Any run of up to capacity() elements starting in
+// the first view, including one that wraps around the end of the ring, is then one plain array: a
+// parser gets data() and size() and never sees the seam. The capacity is a whole number of pages
+// (and of elements); growing enlarges the memfd, maps it again and moves only the wrapped part.
+// Elements are copied as bytes, so _Type must be trivially copyable.
+
+template<typename _Type = char>
+class MagicRingBuffer {
+public:
+    static_assert(std::is_trivially_copyable_v<_Type>, "MagicRingBuffer Error: Element type must be trivially copyable!");
+
+    using value_type = _Type;
+    using size_type = size_t;
+
+    // ctors, capacity is rounded up to whole pages
+    explicit MagicRingBuffer(size_t capacity = 1);
+
+    MagicRingBuffer(const MagicRingBuffer& source) = delete;
+
+    // dtor
+    ~MagicRingBuffer();
+
+    // operator=
+    MagicRingBuffer& operator=(const MagicRingBuffer& right) = delete;
+
+    // element access
+    _Type& operator[](size_t pos);
+    const _Type& operator[](size_t pos) const;
+
+    // the first element, followed by the other size() - 1 in one contiguous run
+    _Type* data();
+    const _Type* data() const;
+
+    // capacity
+    bool empty() const;
+
+    size_t size() const;
+
+    size_t capacity() const;
+
+    void reserve(size_t newCapacity);
+
+    // modifiers
+    void clear();
+
+    // copies count elements after the last one, growing the ring if needed
+    void append(const _Type* values, size_t count);
+
+    // the elements from front to back, a single span as the ring never wraps in memory
+    std::span<_Type> as_span();
+    std::span<const _Type> as_span() const;
+
+    // count contiguous free slots after the last element, growing the ring if needed;
+    // fill them and then commit() them
+    std::span<_Type> writable_span(size_t count);
+
+    // appends the first count slots of writable_span() to the ring
+    void commit(size_t count);
+
+    // drops the first count elements
+    void consume(size_t count);
+
+private:
+    // the smallest whole number of pages holding at least count elements and ending on an element boundary
+    static size_t _bytesFor(size_t count);
+
+    // maps the first bytes of _fd twice into a fresh address range and returns its start
+    _Type* _mapTwice(size_t bytes);
+
+    void _reAllocMem(size_t newCapacity);
+
+private:
+    int _fd; // the memfd both views map
+    _Type* _data; // the first view, the second one follows at _data + _capacity
+    size_t _capacity;
+    size_t _front; // offset of the first element in the first view
+    size_t _size;
+};
+
+// MagicRingBuffer definition
+
+template<typename _Type>
+MagicRingBuffer<_Type>::MagicRingBuffer(size_t capacity) : _fd(-1), _data(nullptr), _capacity(0), _front(0), _size(0) {
+    _fd = memfd_create("MagicRingBuffer", MFD_CLOEXEC);
+    if (_fd == -1) {
+        throw std::runtime_error("MagicRingBuffer Error: memfd_create() failed!");
+    }
+
+    try {
+        _reAllocMem(capacity);
+    } catch (...) {
+        close(_fd);
+        throw;
+    }
+}
+
+template<typename _Type>
+MagicRingBuffer<_Type>::~MagicRingBuffer() {
+    if (_data) {
+        munmap(_data, 2 * _capacity * sizeof(_Type));
+    }
+    close(_fd);
+}
+
+template<typename _Type>
+_Type& MagicRingBuffer<_Type>::operator[](size_t pos) {
+    return _data[_front + pos];
+}
+
+template<typename _Type>
+const _Type& MagicRingBuffer<_Type>::operator[](size_t pos) const {
+    return _data[_front + pos];
+}
+
+template<typename _Type>
+_Type* MagicRingBuffer<_Type>::data() {
+    return _data + _front;
+}
+
+template<typename _Type>
+const _Type* MagicRingBuffer<_Type>::data() const {
+    return _data + _front;
+}
+
+template<typename _Type>
+bool MagicRingBuffer<_Type>::empty() const {
+    return _size == 0;
+}
+
+template<typename _Type>
+size_t MagicRingBuffer<_Type>::size() const {
+    return _size;
+}
+
+template<typename _Type>
+size_t MagicRingBuffer<_Type>::capacity() const {
+    return _capacity;
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::reserve(size_t newCapacity) {
+    if (newCapacity > _capacity) {
+        _reAllocMem(newCapacity);
+    }
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::clear() {
+    _front = 0;
+    _size = 0;
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::append(const _Type* values, size_t count) {
+    const std::span<_Type> slots = writable_span(count);
+    if (count > 0) {
+        std::memcpy(slots.data(), values, count * sizeof(_Type));
+    }
+    commit(count);
+}
+
+template<typename _Type>
+std::span<_Type> MagicRingBuffer<_Type>::as_span() {
+    return std::span<_Type>(_data + _front, _size);
+}
+
+template<typename _Type>
+std::span<const _Type> MagicRingBuffer<_Type>::as_span() const {
+    return std::span<const _Type>(_data + _front, _size);
+}
+
+template<typename _Type>
+std::span<_Type> MagicRingBuffer<_Type>::writable_span(size_t count) {
+    if (_size + count > _capacity) {
+        _reAllocMem(std::max(_size + count, _capacity * constants::_magicRingGrowthFactor));
+    }
+
+    // the free slots start in the first or the second view and run on contiguously
+    return std::span<_Type>(_data + _front + _size, count);
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::commit(size_t count) {
+    if (count > _capacity - _size) {
+        throw std::length_error("MagicRingBuffer Error: Commit past the writable slots!");
+    }
+
+    _size += count;
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::consume(size_t count) {
+    if (count > _size) {
+        throw std::out_of_range("MagicRingBuffer Error: Consume past the last element!");
+    }
+
+    _size -= count;
+    _front += count;
+    // keep _front in the first view, the second one mirrors it
+    if (_front >= _capacity) {
+        _front -= _capacity;
+    }
+}
+
+template<typename _Type>
+size_t MagicRingBuffer<_Type>::_bytesFor(size_t count) {
+    const size_t granule = std::lcm(static_cast<size_t>(sysconf(_SC_PAGESIZE)), sizeof(_Type));
+    const size_t bytes = std::max<size_t>(count, 1) * sizeof(_Type);
+
+    return (bytes + granule - 1) / granule * granule;
+}
+
+template<typename _Type>
+_Type* MagicRingBuffer<_Type>::_mapTwice(size_t bytes) {
+    // reserve the whole range first, so that nothing else can be mapped between the two views
+    void* range = mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (range == MAP_FAILED) {
+        throw std::runtime_error("MagicRingBuffer Error: Reserving the address range failed!");
+    }
+
+    char* first = static_cast<char*>(range);
+    if (mmap(first, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, _fd, 0) == MAP_FAILED ||
+        mmap(first + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, _fd, 0) == MAP_FAILED) {
+        munmap(range, 2 * bytes);
+        throw std::runtime_error("MagicRingBuffer Error: Mapping the memfd twice failed!");
+    }
+
+    return reinterpret_cast<_Type*>(first);
+}
+
+template<typename _Type>
+void MagicRingBuffer<_Type>::_reAllocMem(size_t newCapacity) {
+    // at least up to the end of the elements as they lie now, so the wrapped part fits behind the old end
+    const size_t bytes = _bytesFor(std::max(newCapacity, _front + _size));
+
+    // the file only grows, the elements already in it keep their offsets
+    if (ftruncate(_fd, static_cast<off_t>(bytes)) == -1) {
+        throw std::runtime_error("MagicRingBuffer Error: Growing the memfd failed!");
+    }
+
+    _Type* newData = _mapTwice(bytes);
+    const size_t oldCapacity = _capacity;
+
+    if (_data) {
+        munmap(_data, 2 * oldCapacity * sizeof(_Type));
+    }
+    _data = newData;
+    _capacity = bytes / sizeof(_Type);
+
+    // elements that wrapped to the start of the old ring move up behind the old end,
+    // this is the only copying growth does
+    if (_front + _size > oldCapacity) {
+        const size_t wrapped = _front + _size - oldCapacity;
+        std::memcpy(_data + oldCapacity, _data, wrapped * sizeof(_Type));
+    }
+}
+
+#endif // !MAGICRINGBUFFER_H
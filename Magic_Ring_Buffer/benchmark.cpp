@@ -0,0 +1,223 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "MagicRingBuffer.h"
+#include "../Double_Ended_Queue/Deque.h"
+#include "../Utility/Benchmark.h"
+
+// the stream is read in CHUNK byte pieces, like a socket read, into a ring of RING bytes
+constexpr size_t STREAM = size_t(1) << 28;
+constexpr size_t SOURCE = size_t(1) << 22;
+constexpr size_t CHUNK = 4096;
+constexpr size_t RING = size_t(1) << 16;
+constexpr size_t HEADER = sizeof(uint32_t);
+
+struct Random {
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+
+    uint64_t operator()() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    }
+};
+
+// back to back records of a 4 byte length and a payload of minPayload to maxPayload bytes,
+// cut where a whole record ends so that the source can be replayed
+std::vector<char> makeSource(size_t minPayload, size_t maxPayload) {
+    std::vector<char> source;
+    Random random;
+    while (true) {
+        const uint32_t length = static_cast<uint32_t>(minPayload + random() % (maxPayload - minPayload + 1));
+        if (source.size() + HEADER + length > SOURCE) {
+            break;
+        }
+        const size_t at = source.size();
+        source.resize(at + HEADER + length);
+        std::memcpy(source.data() + at, &length, HEADER);
+        for (size_t pos = 0; pos < length; pos++) {
+            source[at + HEADER + pos] = static_cast<char>(random());
+        }
+    }
+
+    return source;
+}
+
+// the work done on a framed message once the parser has it in one piece
+uint64_t processMessage(const char* payload, size_t length) {
+    uint64_t checksum = length;
+    for (size_t pos = 0; pos < length; pos++) {
+        checksum += static_cast<unsigned char>(payload[pos]);
+    }
+    return checksum;
+}
+
+struct Result {
+    uint64_t checksum = 0;
+    size_t records = 0;
+    size_t copiedBytes = 0;
+};
+
+// copies count bytes at offset out of the two regions of the ring Deque
+void copyOut(Deque<char>::const_span_pair spans, size_t offset, char* target, size_t count) {
+    if (offset < spans.first.size()) {
+        const size_t head = std::min(count, spans.first.size() - offset);
+        std::memcpy(target, spans.first.data() + offset, head);
+        target += head;
+        count -= head;
+        offset = 0;
+    } else {
+        offset -= spans.first.size();
+    }
+    std::memcpy(target, spans.second.data() + offset, count);
+}
+
+// feeds the whole stream through the ring, parse() returns the bytes it framed out of a chunk's worth
+template<typename _Ring, typename _Parse>
+double feed(_Ring& ring, const std::vector<char>& source, _Parse parse) {
+    size_t offset = 0;
+    return measureNs(STREAM / CHUNK, [&] {
+        const size_t count = std::min(CHUNK, source.size() - offset);
+        if constexpr (std::is_same_v<_Ring, Deque<char>>) {
+            const Deque<char>::span_pair slots = ring.writable_spans(count);
+            std::memcpy(slots.first.data(), source.data() + offset, slots.first.size());
+            std::memcpy(slots.second.data(), source.data() + offset + slots.first.size(), slots.second.size());
+        } else {
+            std::memcpy(ring.writable_span(count).data(), source.data() + offset, count);
+        }
+        ring.commit(count);
+        offset = offset + count == source.size() ? 0 : offset + count;
+
+        ring.consume(parse());
+    });
+}
+
+// the copying approach: every message is copied out of the ring Deque before it is processed
+double dequeCopying(const std::vector<char>& source, Result& result) {
+    Deque<char> ring;
+    ring.reserve(RING);
+    std::vector<char> message(SOURCE);
+
+    return feed(ring, source, [&] {
+        const Deque<char>::const_span_pair spans = std::as_const(ring).as_spans();
+        size_t parsed = 0;
+        uint64_t checksum = 0;
+        uint32_t length;
+        while (ring.size() - parsed >= HEADER) {
+            copyOut(spans, parsed, reinterpret_cast<char*>(&length), HEADER);
+            if (ring.size() - parsed - HEADER < length) {
+                break;
+            }
+            copyOut(spans, parsed + HEADER, message.data(), length);
+            checksum += processMessage(message.data(), length);
+            result.copiedBytes += length;
+            result.records++;
+            parsed += HEADER + length;
+        }
+        result.checksum += checksum;
+        return parsed;
+    });
+}
+
+// the two-span approach: messages are processed in place, only those straddling the wrap are copied
+double dequeTwoSpans(const std::vector<char>& source, Result& result) {
+    Deque<char> ring;
+    ring.reserve(RING);
+    std::vector<char> message(SOURCE);
+
+    return feed(ring, source, [&] {
+        const Deque<char>::const_span_pair spans = std::as_const(ring).as_spans();
+        size_t parsed = 0;
+        uint64_t checksum = 0;
+        uint32_t length;
+        while (ring.size() - parsed >= HEADER) {
+            copyOut(spans, parsed, reinterpret_cast<char*>(&length), HEADER);
+            if (ring.size() - parsed - HEADER < length) {
+                break;
+            }
+            const size_t start = parsed + HEADER;
+            if (start + length <= spans.first.size()) {
+                checksum += processMessage(spans.first.data() + start, length);
+            } else if (start >= spans.first.size()) {
+                checksum += processMessage(spans.second.data() + (start - spans.first.size()), length);
+            } else {
+                copyOut(spans, start, message.data(), length);
+                checksum += processMessage(message.data(), length);
+                result.copiedBytes += length;
+            }
+            result.records++;
+            parsed += HEADER + length;
+        }
+        result.checksum += checksum;
+        return parsed;
+    });
+}
+
+// the magic ring: every message is a pointer and a length into the ring
+double magicRing(const std::vector<char>& source, Result& result) {
+    MagicRingBuffer<char> ring(RING);
+
+    return feed(ring, source, [&] {
+        const char* data = ring.data();
+        size_t parsed = 0;
+        uint64_t checksum = 0;
+        uint32_t length;
+        while (ring.size() - parsed >= HEADER) {
+            std::memcpy(&length, data + parsed, HEADER);
+            if (ring.size() - parsed - HEADER < length) {
+                break;
+            }
+            checksum += processMessage(data + parsed + HEADER, length);
+            result.records++;
+            parsed += HEADER + length;
+        }
+        result.checksum += checksum;
+        return parsed;
+    });
+}
+
+void compare(const char* title, size_t minPayload, size_t maxPayload) {
+    const std::vector<char> source = makeSource(minPayload, maxPayload);
+
+    std::cout << title << " (payloads of " << minPayload << " to " << maxPayload << " bytes)" << std::endl;
+    std::cout << std::setw(24) << "parser" << std::setw(14) << "ns/chunk" << std::setw(12) << "MB/s"
+              << std::setw(14) << "ns/record" << std::setw(16) << "copied bytes" << std::endl;
+
+    const auto report = [](const char* name, double ns, const Result& result) {
+        const double chunks = double(STREAM / CHUNK);
+        std::cout << std::setw(24) << name << std::fixed << std::setprecision(1) << std::setw(14) << ns
+                  << std::setw(12) << CHUNK * 1e3 / ns
+                  << std::setw(14) << ns * chunks / double(result.records)
+                  << std::setw(15) << std::setprecision(2) << 100.0 * double(result.copiedBytes) / double(STREAM) << "%"
+                  << std::endl;
+        doNotOptimize(result.checksum);
+    };
+
+    Result copying;
+    Result twoSpans;
+    Result magic;
+    report("Deque, copy every", dequeCopying(source, copying), copying);
+    report("Deque, copy straddling", dequeTwoSpans(source, twoSpans), twoSpans);
+    report("MagicRingBuffer", magicRing(source, magic), magic);
+
+    if (copying.checksum != magic.checksum || twoSpans.checksum != magic.checksum) {
+        std::cout << "checksums differ!" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main() {
+    std::cout << "MESSAGE FRAMING, " << (STREAM >> 20) << " MiB of length prefixed records read in "
+              << CHUNK << " byte chunks into a " << (RING >> 10) << " KiB ring\n" << std::endl;
+
+    compare("SMALL MESSAGES", 8, 64);
+    compare("MEDIUM MESSAGES", 64, 1024);
+    compare("LARGE MESSAGES", 1024, 16384);
+
+    return 0;
+}
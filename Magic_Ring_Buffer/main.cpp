@@ -0,0 +1,109 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+
+#include "MagicRingBuffer.h"
+
+// a record of the demo stream: a one byte length followed by that many bytes of text
+void appendRecord(MagicRingBuffer<char>& ring, const std::string& text) {
+    const char length = static_cast<char>(text.size());
+    ring.append(&length, 1);
+    ring.append(text.data(), text.size());
+}
+
+// the parser reads each record through a plain pointer, wherever the ring wraps
+void parseRecords(MagicRingBuffer<char>& ring, std::ofstream& tFile) {
+    while (!ring.empty() && ring.size() > static_cast<size_t>(ring[0])) {
+        const char* record = ring.data();
+        const size_t length = static_cast<size_t>(record[0]);
+        tFile << "record \"" << std::string(record + 1, length) << "\"" << std::endl;
+        ring.consume(length + 1);
+    }
+}
+
+template<typename _Type>
+void writeState(const MagicRingBuffer<_Type>& ring, std::ofstream& tFile) {
+    tFile << " size() = " << ring.size() << ", capacity() = " << ring.capacity() << std::endl;
+}
+
+int main() {
+    std::ofstream myMagicRingBufferTestFile("MagicRingBufferTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myMagicRingBufferTestFile << "MAGIC RING BUFFER\n" << std::endl;
+
+    {
+        MagicRingBuffer<char> ring(100);
+        myMagicRingBufferTestFile << "MagicRingBuffer<char> ring(100), capacity rounded up to whole pages:";
+        writeState(ring, myMagicRingBufferTestFile);
+
+        // move the front close to the end of the ring, so the next record wraps around it
+        const size_t filler = ring.capacity() - 5;
+        ring.writable_span(filler);
+        ring.commit(filler);
+        ring.consume(filler);
+        myMagicRingBufferTestFile << "commit() and consume() " << filler << " bytes:";
+        writeState(ring, myMagicRingBufferTestFile);
+
+        appendRecord(ring, "wrapped around the end");
+        appendRecord(ring, "after it");
+        myMagicRingBufferTestFile << "two records appended, the first one straddles the end of the ring:";
+        writeState(ring, myMagicRingBufferTestFile);
+        parseRecords(ring, myMagicRingBufferTestFile);
+    }
+
+    {
+        MagicRingBuffer<uint32_t> ring(1);
+        myMagicRingBufferTestFile << "\nMagicRingBuffer<uint32_t> ring(1):";
+        writeState(ring, myMagicRingBufferTestFile);
+
+        // wrap the contents around the end, then grow past the capacity
+        const size_t capacity = ring.capacity();
+        for (uint32_t value = 0; value < capacity; value++) {
+            ring.append(&value, 1);
+        }
+        ring.consume(capacity - 3);
+        for (uint32_t value = static_cast<uint32_t>(capacity); value < capacity + 3; value++) {
+            ring.append(&value, 1);
+        }
+        myMagicRingBufferTestFile << "wrapped contents:";
+        for (uint32_t value : ring.as_span()) {
+            myMagicRingBufferTestFile << " " << value;
+        }
+        writeState(ring, myMagicRingBufferTestFile);
+
+        ring.reserve(capacity + 1);
+        myMagicRingBufferTestFile << "reserve(" << capacity + 1 << "), the contents survive the remapping:";
+        for (uint32_t value : ring.as_span()) {
+            myMagicRingBufferTestFile << " " << value;
+        }
+        writeState(ring, myMagicRingBufferTestFile);
+
+        const std::span<uint32_t> slots = ring.writable_span(ring.capacity());
+        for (size_t pos = 0; pos < slots.size(); pos++) {
+            slots[pos] = static_cast<uint32_t>(pos);
+        }
+        ring.commit(slots.size());
+        myMagicRingBufferTestFile << "writable_span(capacity()) grows the ring, front() = " << ring[0]
+                                  << ", back() = " << ring[ring.size() - 1] << ":";
+        writeState(ring, myMagicRingBufferTestFile);
+
+        try {
+            ring.consume(ring.size() + 1);
+        } catch (const std::out_of_range& e) {
+            myMagicRingBufferTestFile << "consume(size() + 1): " << e.what() << std::endl;
+        }
+
+        ring.clear();
+        try {
+            ring.commit(ring.capacity() + 1);
+        } catch (const std::length_error& e) {
+            myMagicRingBufferTestFile << "commit(capacity() + 1): " << e.what() << std::endl;
+        }
+    }
+
+    myMagicRingBufferTestFile.close();
+
+    return 0;
+}
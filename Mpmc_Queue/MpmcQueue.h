@@ -0,0 +1,324 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include "../Utility/CacheLine.h"
+#include "../Utility/ParkingLot.h"
+
+namespace constants {
+    constexpr size_t DEFAULT_MPMC_QUEUE_CAPACITY = 1024;
+    // failed attempts of a blocking push or pop before the thread sleeps on an atomic wait
+    constexpr size_t MPMC_QUEUE_SPIN_ROUNDS = 64;
+}
+
+// interface of a bounded multi-producer multi-consumer queue after Dmitry Vyukov's design.
+// The ring is a power-of-two array of slots indexed with a mask, like the ring Deque, and every slot
+// carries a sequence number telling which lap of which side may use it next: pos when it is free for
+// the producer holding ticket pos, pos + 1 once that producer has published into it. A producer takes
+// a ticket with a single CAS on _enqueuePos and a consumer with a single CAS on _dequeuePos; the
+// slot's sequence (acquire/release) then hands the element over, so producers and consumers never
+// touch the same index. The blocking variants spin MPMC_QUEUE_SPIN_ROUNDS times and then park in a
+// ParkingLot of their side; the other side only notifies when somebody is parked.
+// A claimed ticket must be published, or every consumer of its lap waits forever: an element whose
+// constructor may throw is built before the ticket is taken and then moved in, which must not throw.
+// Likewise a consumer moves the element out of its slot with the move constructor and assigns it only
+// once the slot is released.
+
+template<typename _Type>
+class MpmcQueue {
+public:
+    static_assert(std::is_nothrow_move_constructible_v<_Type>, "MpmcQueue Error: Element type must be nothrow move constructible!");
+
+    using value_type = _Type;
+    using size_type = size_t;
+
+    // ctors
+    explicit MpmcQueue(size_t capacity = constants::DEFAULT_MPMC_QUEUE_CAPACITY);
+
+    MpmcQueue(const MpmcQueue& source) = delete;
+
+    // dtor, must not run concurrently with any other member
+    ~MpmcQueue();
+
+    // operator=
+    MpmcQueue& operator=(const MpmcQueue& right) = delete;
+
+    // capacity, exact only while no other thread operates on the queue
+    bool empty() const;
+
+    size_t size() const;
+
+    size_t capacity() const;
+
+    // non-blocking modifiers, false when the queue is full or empty
+    bool try_push(const _Type& value);
+    bool try_push(_Type&& value);
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_pop(_Type& value);
+
+    // blocking modifiers, wait until there is room or an element
+    void push(const _Type& value);
+    void push(_Type&& value);
+
+    _Type pop();
+
+private:
+    struct _Slot {
+        std::atomic<size_t> _sequence;
+        alignas(_Type) unsigned char _storage[sizeof(_Type)];
+
+        _Type* element() {
+            return std::launder(reinterpret_cast<_Type*>(_storage));
+        }
+    };
+
+    template<typename... Args>
+    bool _tryEnqueue(Args&&... args);
+
+    // hands the oldest element to sink as an rvalue, false if the queue is empty
+    template<typename Sink>
+    bool _tryDequeue(Sink&& sink);
+
+    // spins until ready() is true, then parks in lot
+    template<typename Ready>
+    static void _wait(ParkingLot& lot, Ready&& ready);
+
+private:
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<size_t> _enqueuePos; // next producer ticket
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<size_t> _dequeuePos; // next consumer ticket
+
+    // parking of the blocking variants
+    alignas(constants::CACHE_LINE_SIZE) ParkingLot _consumers; // notified after a push
+    alignas(constants::CACHE_LINE_SIZE) ParkingLot _producers; // notified after a pop
+
+    // read-only after construction
+    alignas(constants::CACHE_LINE_SIZE) size_t _mask;
+    _Slot* _slots;
+};
+
+// MpmcQueue definition
+
+template<typename _Type>
+MpmcQueue<_Type>::MpmcQueue(size_t capacity) :
+    _enqueuePos(0), _dequeuePos(0), _consumers(), _producers(),
+    _mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), _slots(new _Slot[_mask + 1]) {
+    for (size_t pos = 0; pos <= _mask; pos++) {
+        _slots[pos]._sequence.store(pos, std::memory_order_relaxed);
+    }
+}
+
+template<typename _Type>
+MpmcQueue<_Type>::~MpmcQueue() {
+    const size_t enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+    for (size_t pos = _dequeuePos.load(std::memory_order_relaxed); pos != enqueuePos; pos++) {
+        _slots[pos & _mask].element()->~_Type();
+    }
+
+    delete[] _slots;
+}
+
+template<typename _Type>
+bool MpmcQueue<_Type>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type>
+size_t MpmcQueue<_Type>::size() const {
+    const size_t dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+    const size_t enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+
+    // _dequeuePos is read first and never passes _enqueuePos, but pushes in between can take the difference past capacity()
+    return std::min(enqueuePos - dequeuePos, capacity());
+}
+
+template<typename _Type>
+size_t MpmcQueue<_Type>::capacity() const {
+    return _mask + 1;
+}
+
+template<typename _Type>
+bool MpmcQueue<_Type>::try_push(const _Type& value) {
+    return try_emplace(value);
+}
+
+template<typename _Type>
+bool MpmcQueue<_Type>::try_push(_Type&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename _Type>
+template<typename... Args>
+bool MpmcQueue<_Type>::try_emplace(Args&&... args) {
+    if (!_tryEnqueue(std::forward<Args>(args)...)) {
+        return false;
+    }
+
+    _consumers.notify_all();
+
+    return true;
+}
+
+template<typename _Type>
+bool MpmcQueue<_Type>::try_pop(_Type& value) {
+    if constexpr (!std::is_nothrow_move_assignable_v<_Type>) {
+        // a throw inside _tryDequeue would leave the slot unreleased, so assign once it is released, as pop() does
+        std::optional<_Type> element;
+        if (!_tryDequeue([&element](_Type&& source) { element.emplace(std::move(source)); })) {
+            return false;
+        }
+
+        _producers.notify_all();
+        value = std::move(*element);
+
+        return true;
+    }
+
+    if (!_tryDequeue([&value](_Type&& element) { value = std::move(element); })) {
+        return false;
+    }
+
+    _producers.notify_all();
+
+    return true;
+}
+
+template<typename _Type>
+void MpmcQueue<_Type>::push(const _Type& value) {
+    if constexpr (!std::is_nothrow_copy_constructible_v<_Type>) {
+        // copy once up front instead of on every attempt _tryEnqueue makes
+        push(_Type(value));
+        return;
+    }
+
+    while (!_tryEnqueue(value)) {
+        _wait(_producers, [this] { return size() < capacity(); });
+    }
+
+    _consumers.notify_all();
+}
+
+template<typename _Type>
+void MpmcQueue<_Type>::push(_Type&& value) {
+    // a failed attempt does not touch value, so it can be moved from again
+    while (!_tryEnqueue(std::move(value))) {
+        _wait(_producers, [this] { return size() < capacity(); });
+    }
+
+    _consumers.notify_all();
+}
+
+template<typename _Type>
+_Type MpmcQueue<_Type>::pop() {
+    // constructed only once an element is there, so _Type needs no default constructor
+    std::optional<_Type> value;
+    while (!_tryDequeue([&value](_Type&& element) { value.emplace(std::move(element)); })) {
+        _wait(_consumers, [this] { return !empty(); });
+    }
+
+    _producers.notify_all();
+
+    return std::move(*value);
+}
+
+template<typename _Type>
+template<typename... Args>
+bool MpmcQueue<_Type>::_tryEnqueue(Args&&... args) {
+    if constexpr (!std::is_nothrow_constructible_v<_Type, Args&&...>) {
+        // a throw after the ticket is claimed would leave its slot unpublished, so construct first
+        return _tryEnqueue(_Type(std::forward<Args>(args)...));
+    }
+
+    size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    _Slot* slot = nullptr;
+
+    while (true) {
+        slot = &_slots[pos & _mask];
+        // acquire: pairs with the consumer's release, the previous lap's element is destroyed
+        const size_t sequence = slot->_sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            // the slot is free for ticket pos, claim the ticket
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the consumer of the previous lap has not freed the slot yet, the queue is full
+            return false;
+        } else {
+            // another producer took ticket pos
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    ::new(static_cast<void*>(slot->_storage)) _Type(std::forward<Args>(args)...);
+
+    // release: the element is constructed before a consumer can claim it
+    slot->_sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename _Type>
+template<typename Sink>
+bool MpmcQueue<_Type>::_tryDequeue(Sink&& sink) {
+    size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+    _Slot* slot = nullptr;
+
+    while (true) {
+        slot = &_slots[pos & _mask];
+        // acquire: pairs with the producer's release, the element is constructed
+        const size_t sequence = slot->_sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0) {
+            // the slot holds the element of ticket pos, claim the ticket
+            if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the producer of ticket pos has not published yet, the queue is empty
+            return false;
+        } else {
+            // another consumer took ticket pos
+            pos = _dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    _Type* element = slot->element();
+    sink(std::move(*element));
+    element->~_Type();
+
+    // release: the slot is free for the producer of the next lap
+    slot->_sequence.store(pos + _mask + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename _Type>
+template<typename Ready>
+void MpmcQueue<_Type>::_wait(ParkingLot& lot, Ready&& ready) {
+    for (size_t round = 0; round < constants::MPMC_QUEUE_SPIN_ROUNDS; round++) {
+        if (ready()) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    lot.park(ready);
+}
+
+#endif // !MPMCQUEUE_H
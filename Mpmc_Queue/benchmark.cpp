@@ -0,0 +1,128 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "MpmcQueue.h"
+#include "../Double_Ended_Queue/Deque.h"
+
+constexpr uint64_t TRANSFERS = 1 << 21;
+constexpr size_t QUEUE_CAPACITY = 1024;
+
+// baseline: the ring Deque behind one mutex
+class LockedRing {
+public:
+    LockedRing() {
+        _deque.reserve(QUEUE_CAPACITY);
+    }
+
+    bool try_push(uint64_t value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.size() >= QUEUE_CAPACITY) {
+            return false;
+        }
+        _deque.push_back(value);
+
+        return true;
+    }
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.empty()) {
+            return false;
+        }
+        value = _deque.front();
+        _deque.pop_front();
+
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    Deque<uint64_t> _deque;
+};
+
+// MpmcQueue with the capacity of the baseline
+class LockFreeQueue : public MpmcQueue<uint64_t> {
+public:
+    LockFreeQueue() : MpmcQueue<uint64_t>(QUEUE_CAPACITY) {}
+};
+
+// waiting sides yield, so the benchmark also makes progress when the threads share fewer cores
+inline void backOff() {
+    std::this_thread::yield();
+}
+
+// share of TRANSFERS handled by thread index out of count threads
+uint64_t share(unsigned index, unsigned count) {
+    return TRANSFERS / count + (index < TRANSFERS % count ? 1 : 0);
+}
+
+// producers push 1..TRANSFERS between them, consumers pop all of it; returns millions of elements per second
+template<typename _Queue>
+double throughput(unsigned producersCount, unsigned consumersCount, bool& checksumOk) {
+    _Queue queue;
+    std::atomic<uint64_t> sum{ 0 };
+    std::vector<std::thread> threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    uint64_t first = 1;
+    for (unsigned p = 0; p < producersCount; p++) {
+        const uint64_t count = share(p, producersCount);
+        threads.emplace_back([&queue, first, count] {
+            for (uint64_t value = first; value < first + count; value++) {
+                while (!queue.try_push(value)) {
+                    backOff();
+                }
+            }
+        });
+        first += count;
+    }
+    for (unsigned c = 0; c < consumersCount; c++) {
+        threads.emplace_back([&queue, &sum, count = share(c, consumersCount)] {
+            uint64_t localSum = 0, value = 0;
+            for (uint64_t received = 0; received < count; received++) {
+                while (!queue.try_pop(value)) {
+                    backOff();
+                }
+                localSum += value;
+            }
+            sum.fetch_add(localSum);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    checksumOk = sum.load() == TRANSFERS * (TRANSFERS + 1) / 2;
+
+    return TRANSFERS / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+void printThroughput(const char* name, double mops, bool checksumOk) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << mops << " M elements/s" << (checksumOk ? "" : "   CHECKSUM MISMATCH") << std::endl;
+}
+
+int main() {
+    std::cout << "PRODUCERS:CONSUMERS (" << TRANSFERS << " uint64_t, queue of " << QUEUE_CAPACITY << ", "
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    const unsigned ratios[][2] = { { 1, 1 }, { 1, 3 }, { 3, 1 }, { 2, 2 }, { 4, 4 } };
+
+    bool checksumOk = false;
+    for (const auto& ratio : ratios) {
+        std::cout << "\n" << ratio[0] << ":" << ratio[1] << std::endl;
+
+        double mops = throughput<LockedRing>(ratio[0], ratio[1], checksumOk);
+        printThroughput("mutex + ring Deque", mops, checksumOk);
+        mops = throughput<LockFreeQueue>(ratio[0], ratio[1], checksumOk);
+        printThroughput("MpmcQueue", mops, checksumOk);
+    }
+
+    return 0;
+}
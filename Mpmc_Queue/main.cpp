@@ -0,0 +1,151 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <atomic>
+
+#include "MpmcQueue.h"
+
+// an element whose copy constructor throws for negative values
+struct Fragile {
+    explicit Fragile(int value) : _value(value) {}
+
+    Fragile(const Fragile& source) : _value(source._value) {
+        if (_value < 0) {
+            throw std::runtime_error("Fragile Error: Copy of a negative value!");
+        }
+    }
+
+    Fragile(Fragile&& source) noexcept = default;
+    Fragile& operator=(const Fragile& right) = default;
+
+    // throws for negative values too, so try_pop() into a Fragile has to assign outside the slot
+    Fragile& operator=(Fragile&& right) {
+        if (right._value < 0) {
+            throw std::runtime_error("Fragile Error: Move assignment of a negative value!");
+        }
+        _value = right._value;
+        return *this;
+    }
+
+    int _value;
+};
+
+int main() {
+    std::ofstream myMpmcQueueTestFile("MpmcQueueTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myMpmcQueueTestFile << "MPMC QUEUE\n" << std::endl;
+
+    // single-threaded use
+    {
+        MpmcQueue<std::string> queue(3);
+
+        myMpmcQueueTestFile << "MpmcQueue<std::string>(3), capacity() = " << queue.capacity()
+                            << ", empty() = " << std::boolalpha << queue.empty() << std::endl;
+
+        queue.try_push("first");
+        std::string second = "second";
+        queue.try_push(second);
+        queue.try_emplace(3, '*');
+        queue.push("fourth");
+        myMpmcQueueTestFile << "After try_push(\"first\"), try_push(\"second\"), try_emplace(3, '*'), push(\"fourth\"), size() = "
+                            << queue.size() << std::endl;
+        myMpmcQueueTestFile << "try_push() on the full queue = " << queue.try_push("fifth") << std::endl;
+
+        myMpmcQueueTestFile << "pop() = " << queue.pop() << std::endl;
+
+        std::string value;
+        myMpmcQueueTestFile << "try_pop() until empty:";
+        while (queue.try_pop(value)) {
+            myMpmcQueueTestFile << " " << value;
+        }
+        myMpmcQueueTestFile << std::endl;
+        myMpmcQueueTestFile << "try_pop() on the empty queue = " << queue.try_pop(value) << std::endl;
+    }
+
+    // a throwing copy leaves the queue usable: the element is built before a slot is claimed
+    {
+        MpmcQueue<Fragile> queue(4);
+        const Fragile negative(-1);
+
+        try {
+            queue.try_push(negative);
+        } catch (const std::runtime_error& e) {
+            myMpmcQueueTestFile << "\ntry_push() of a Fragile whose copy throws: " << e.what() << std::endl;
+        }
+        try {
+            queue.push(negative);
+        } catch (const std::runtime_error& e) {
+            myMpmcQueueTestFile << "push() of a Fragile whose copy throws: " << e.what() << std::endl;
+        }
+
+        queue.try_emplace(-2);
+        Fragile value(0);
+        try {
+            queue.try_pop(value);
+        } catch (const std::runtime_error& e) {
+            myMpmcQueueTestFile << "try_pop() of a Fragile whose move assignment throws: " << e.what()
+                                << ", size() = " << queue.size() << std::endl;
+        }
+
+        // the slot of the throwing pop comes around again within two laps of the queue
+        bool cycled = true;
+        for (int i = 0; i < 2 * static_cast<int>(queue.capacity()); i++) {
+            cycled = cycled && queue.try_emplace(i) && queue.try_pop(value) && value._value == i;
+        }
+        myMpmcQueueTestFile << "two laps of try_emplace() and try_pop() after it succeed: " << cycled << std::endl;
+
+        queue.try_emplace(7);
+        queue.push(Fragile(8));
+        queue.try_pop(value);
+        myMpmcQueueTestFile << "then try_emplace(7), push(Fragile(8)), try_pop() = " << value._value << ", pop() = " << queue.pop()._value
+                            << ", empty() = " << queue.empty() << std::endl;
+    }
+
+    // blocking producers and consumers on a small queue, every value must be popped exactly once
+    {
+        const unsigned producersCount = 4;
+        const unsigned consumersCount = 3;
+        const uint64_t pushesPerProducer = 100000;
+        const uint64_t total = producersCount * pushesPerProducer;
+
+        MpmcQueue<uint64_t> queue(16);
+        std::atomic<uint64_t> poppedSum{ 0 };
+        std::atomic<uint64_t> poppedCount{ 0 };
+        std::vector<std::thread> threads;
+
+        for (unsigned p = 0; p < producersCount; p++) {
+            threads.emplace_back([&queue, p] {
+                for (uint64_t i = 1; i <= pushesPerProducer; i++) {
+                    queue.push(p * pushesPerProducer + i);
+                }
+            });
+        }
+        for (unsigned c = 0; c < consumersCount; c++) {
+            threads.emplace_back([&queue, &poppedSum, &poppedCount, c] {
+                // the consumers split the total between them, so every pop() is matched by a push()
+                const uint64_t share = total / consumersCount + (c < total % consumersCount ? 1 : 0);
+                uint64_t sum = 0;
+                for (uint64_t i = 0; i < share; i++) {
+                    sum += queue.pop();
+                }
+                poppedSum.fetch_add(sum);
+                poppedCount.fetch_add(share);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        myMpmcQueueTestFile << "\n4 producers push() 100000 values each, 3 consumers pop() them through a queue of 16" << std::endl;
+        myMpmcQueueTestFile << "popped " << poppedCount.load() << " values, sum = " << poppedSum.load()
+                            << ", expected sum = " << total * (total + 1) / 2 << std::endl;
+        myMpmcQueueTestFile << "empty() = " << queue.empty() << std::endl;
+    }
+
+    myMpmcQueueTestFile.close();
+
+    return 0;
+}
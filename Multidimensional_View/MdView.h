@@ -0,0 +1,475 @@
+#ifndef MDVIEW_H
+#define MDVIEW_H
+
+#include <bit>
+#include <cstdint>
+#include <concepts>
+#include <iterator>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+// mdspan-style non-owning two-dimensional view over contiguous storage such as Vector or Array
+//
+// The view maps a (row, col) pair to an offset in the storage through a layout policy. Besides the plain
+// row- and column-major orders there are a tiled layout, which stores each _TileRows x _TileCols block
+// contiguously, and a Z-order (Morton) layout, which interleaves the bits of row and column so that
+// nearby elements in both directions stay nearby in memory. Blocked traversals, such as a transpose or a
+// stencil walked tile by tile, then touch far fewer cache lines and pages than they do over row-major data.
+
+namespace constants {
+    constexpr size_t DYNAMIC_EXTENT = static_cast<size_t>(-1);
+
+    // 16 floats fill one 64-byte cache line, so each tile row of the default tiled layout is one line
+    constexpr size_t MDVIEW_DEFAULT_TILE = 16;
+}
+
+// number of rows and columns, each either fixed at compile time or given at runtime
+
+template<size_t _Rows = constants::DYNAMIC_EXTENT, size_t _Cols = constants::DYNAMIC_EXTENT>
+class Extents2D {
+public:
+    static constexpr size_t static_rows = _Rows;
+    static constexpr size_t static_cols = _Cols;
+
+    // ctors
+    constexpr Extents2D() : _rows(_Rows == constants::DYNAMIC_EXTENT ? 0 : _Rows), _cols(_Cols == constants::DYNAMIC_EXTENT ? 0 : _Cols) {}
+
+    constexpr Extents2D(size_t rows, size_t cols) : _rows(rows), _cols(cols) {
+        if ((_Rows != constants::DYNAMIC_EXTENT && rows != _Rows) || (_Cols != constants::DYNAMIC_EXTENT && cols != _Cols)) {
+            throw std::invalid_argument("Extents2D Error: Runtime extent differs from the static one!");
+        }
+    }
+
+    constexpr size_t rows() const {
+        if constexpr (_Rows != constants::DYNAMIC_EXTENT) {
+            return _Rows;
+        } else {
+            return _rows;
+        }
+    }
+
+    constexpr size_t cols() const {
+        if constexpr (_Cols != constants::DYNAMIC_EXTENT) {
+            return _Cols;
+        } else {
+            return _cols;
+        }
+    }
+
+    constexpr size_t size() const {
+        return rows() * cols();
+    }
+
+private:
+    size_t _rows;
+    size_t _cols;
+};
+
+// layouts: each provides mapping<_Extents> with operator()(row, col) and required_span_size()
+
+struct LayoutRowMajor {
+    template<typename _Extents>
+    class mapping {
+    public:
+        constexpr mapping() = default;
+
+        constexpr explicit mapping(const _Extents& extents) : _extents(extents) {}
+
+        constexpr size_t operator()(size_t row, size_t col) const {
+            return row * _extents.cols() + col;
+        }
+
+        constexpr size_t required_span_size() const {
+            return _extents.size();
+        }
+
+        constexpr const _Extents& extents() const {
+            return _extents;
+        }
+
+    private:
+        _Extents _extents;
+    };
+};
+
+struct LayoutColumnMajor {
+    template<typename _Extents>
+    class mapping {
+    public:
+        constexpr mapping() = default;
+
+        constexpr explicit mapping(const _Extents& extents) : _extents(extents) {}
+
+        constexpr size_t operator()(size_t row, size_t col) const {
+            return col * _extents.rows() + row;
+        }
+
+        constexpr size_t required_span_size() const {
+            return _extents.size();
+        }
+
+        constexpr const _Extents& extents() const {
+            return _extents;
+        }
+
+    private:
+        _Extents _extents;
+    };
+};
+
+// blocks of _TileRows x _TileCols elements, row-major inside a block and row-major over the blocks;
+// the extents are padded up to whole tiles, so the storage needs required_span_size() elements
+template<size_t _TileRows = constants::MDVIEW_DEFAULT_TILE, size_t _TileCols = constants::MDVIEW_DEFAULT_TILE>
+struct LayoutTiled {
+    static_assert(std::has_single_bit(_TileRows) && std::has_single_bit(_TileCols),
+        "LayoutTiled Error: Tile sizes must be powers of two!");
+
+    static constexpr size_t tile_rows = _TileRows;
+    static constexpr size_t tile_cols = _TileCols;
+
+    template<typename _Extents>
+    class mapping {
+    public:
+        constexpr mapping() : mapping(_Extents()) {}
+
+        constexpr explicit mapping(const _Extents& extents)
+            : _extents(extents), _tilesPerRow((extents.cols() + _TileCols - 1) / _TileCols) {}
+
+        constexpr size_t operator()(size_t row, size_t col) const {
+            // the divisions and remainders are by powers of two, hence shifts and masks
+            const size_t tile = (row / _TileRows) * _tilesPerRowCount() + col / _TileCols;
+            return tile * (_TileRows * _TileCols) + (row % _TileRows) * _TileCols + col % _TileCols;
+        }
+
+        constexpr size_t required_span_size() const {
+            return (_extents.rows() + _TileRows - 1) / _TileRows * _tilesPerRowCount() * (_TileRows * _TileCols);
+        }
+
+        constexpr const _Extents& extents() const {
+            return _extents;
+        }
+
+    private:
+        constexpr size_t _tilesPerRowCount() const {
+            // a constant for compile-time extents, so the tile index needs no multiplication by a loaded value
+            if constexpr (_Extents::static_cols != constants::DYNAMIC_EXTENT) {
+                return (_Extents::static_cols + _TileCols - 1) / _TileCols;
+            } else {
+                return _tilesPerRow;
+            }
+        }
+
+    private:
+        _Extents _extents;
+        size_t _tilesPerRow; // the number of tiles covering one padded row
+    };
+};
+
+// spreads the low 32 bits of value to the even bit positions
+constexpr uint64_t _spreadBits(uint64_t value) {
+#ifdef __BMI2__
+    if (!std::is_constant_evaluated()) {
+        return _pdep_u64(value, 0x5555555555555555ULL);
+    }
+#endif
+
+    value &= 0xFFFFFFFFULL;
+    value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+    value = (value | (value << 8)) & 0x00FF00FF00FF00FFULL;
+    value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    value = (value | (value << 2)) & 0x3333333333333333ULL;
+    value = (value | (value << 1)) & 0x5555555555555555ULL;
+
+    return value;
+}
+
+// Z-order: the column bits go to the even and the row bits to the odd positions of the offset;
+// the extents are padded up to the enclosing power-of-two square
+struct LayoutMorton {
+    template<typename _Extents>
+    class mapping {
+    public:
+        constexpr mapping() : mapping(_Extents()) {}
+
+        constexpr explicit mapping(const _Extents& extents)
+            : _extents(extents), _side(std::bit_ceil(std::max(extents.rows(), extents.cols()))) {}
+
+        constexpr size_t operator()(size_t row, size_t col) const {
+            return _spreadBits(col) | (_spreadBits(row) << 1);
+        }
+
+        constexpr size_t required_span_size() const {
+            return _extents.size() == 0 ? 0 : _side * _side;
+        }
+
+        constexpr const _Extents& extents() const {
+            return _extents;
+        }
+
+    private:
+        _Extents _extents;
+        size_t _side; // side of the padded square
+    };
+};
+
+template<typename _Layout>
+concept _TiledLayout = requires {
+    _Layout::tile_rows;
+    _Layout::tile_cols;
+};
+
+// anything with data() and size(), e.g. Vector and Array, whose elements the view can refer to
+template<typename _Storage, typename _Type>
+concept _MdStorage = requires (_Storage& storage) {
+    { storage.data() } -> std::convertible_to<_Type*>;
+    { storage.size() } -> std::convertible_to<size_t>;
+};
+
+template<typename _View>
+class _MdTileRange;
+
+// interface of two-dimensional view; a view is cheap to copy and never owns the elements it refers to
+
+template<typename _Type, typename _Extents = Extents2D<>, typename _Layout = LayoutRowMajor>
+class MdView {
+public:
+    using element_type = _Type;
+    using value_type = std::remove_cv_t<_Type>;
+    using extents_type = _Extents;
+    using layout_type = _Layout;
+    using mapping_type = typename _Layout::template mapping<_Extents>;
+
+    // ctors
+    constexpr MdView() : MdView(nullptr) {}
+
+    constexpr explicit MdView(_Type* data, const _Extents& extents = _Extents());
+
+    template<typename _Storage>
+    requires _MdStorage<_Storage, _Type>
+    constexpr explicit MdView(_Storage& storage, const _Extents& extents = _Extents());
+
+    // the number of elements storage for the given extents must hold under this layout
+    static constexpr size_t required_span_size(const _Extents& extents);
+
+    // element access
+    constexpr _Type& operator()(size_t row, size_t col) const;
+
+    constexpr _Type& at(size_t row, size_t col) const;
+
+    constexpr _Type* data_handle() const;
+
+    constexpr const mapping_type& mapping() const;
+
+    // capacity
+    constexpr size_t rows() const;
+
+    constexpr size_t cols() const;
+
+    constexpr size_t size() const;
+
+    constexpr bool empty() const;
+
+    // views
+    constexpr MdView subview(size_t firstRow, size_t firstCol, size_t rows, size_t cols) const;
+
+    constexpr _MdTileRange<MdView> tiles(size_t tileRows, size_t tileCols) const;
+
+    // the tiles of a tiled layout, each of them contiguous in storage
+    constexpr _MdTileRange<MdView> tiles() const requires _TiledLayout<_Layout>;
+
+private:
+    _Type* _data; // the first element of the viewed storage
+    mapping_type _mapping; // maps indices of the whole storage, a sub-view keeps the one of its parent
+    size_t _firstRow; // the window of the storage this view covers
+    size_t _firstCol;
+    size_t _rows;
+    size_t _cols;
+};
+
+// MdView definition
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr MdView<_Type, _Extents, _Layout>::MdView(_Type* data, const _Extents& extents)
+    : _data(data), _mapping(extents), _firstRow(0), _firstCol(0), _rows(extents.rows()), _cols(extents.cols()) {}
+
+template<typename _Type, typename _Extents, typename _Layout>
+template<typename _Storage>
+requires _MdStorage<_Storage, _Type>
+constexpr MdView<_Type, _Extents, _Layout>::MdView(_Storage& storage, const _Extents& extents)
+    : MdView(storage.data(), extents) {
+    if (storage.size() < _mapping.required_span_size()) {
+        throw std::length_error("MdView Error: Storage is too small for the extents!");
+    }
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr size_t MdView<_Type, _Extents, _Layout>::required_span_size(const _Extents& extents) {
+    return mapping_type(extents).required_span_size();
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr _Type& MdView<_Type, _Extents, _Layout>::operator()(size_t row, size_t col) const {
+    return _data[_mapping(_firstRow + row, _firstCol + col)];
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr _Type& MdView<_Type, _Extents, _Layout>::at(size_t row, size_t col) const {
+    if (row >= _rows || col >= _cols) {
+        throw std::out_of_range("MdView Error: Index out of bounds!");
+    }
+
+    return (*this)(row, col);
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr _Type* MdView<_Type, _Extents, _Layout>::data_handle() const {
+    return _data;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr const typename MdView<_Type, _Extents, _Layout>::mapping_type& MdView<_Type, _Extents, _Layout>::mapping() const {
+    return _mapping;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr size_t MdView<_Type, _Extents, _Layout>::rows() const {
+    return _rows;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr size_t MdView<_Type, _Extents, _Layout>::cols() const {
+    return _cols;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr size_t MdView<_Type, _Extents, _Layout>::size() const {
+    return _rows * _cols;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr bool MdView<_Type, _Extents, _Layout>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr MdView<_Type, _Extents, _Layout> MdView<_Type, _Extents, _Layout>::subview(size_t firstRow, size_t firstCol, size_t rows, size_t cols) const {
+    if (firstRow + rows > _rows || firstCol + cols > _cols) {
+        throw std::out_of_range("MdView Error: Sub-view exceeds the view!");
+    }
+
+    MdView sub = *this;
+    sub._firstRow += firstRow;
+    sub._firstCol += firstCol;
+    sub._rows = rows;
+    sub._cols = cols;
+
+    return sub;
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr _MdTileRange<MdView<_Type, _Extents, _Layout>> MdView<_Type, _Extents, _Layout>::tiles(size_t tileRows, size_t tileCols) const {
+    if (tileRows == 0 || tileCols == 0) {
+        throw std::invalid_argument("MdView Error: Tile sizes must not be zero!");
+    }
+
+    return _MdTileRange<MdView>(*this, tileRows, tileCols);
+}
+
+template<typename _Type, typename _Extents, typename _Layout>
+constexpr _MdTileRange<MdView<_Type, _Extents, _Layout>> MdView<_Type, _Extents, _Layout>::tiles() const requires _TiledLayout<_Layout> {
+    return tiles(_Layout::tile_rows, _Layout::tile_cols);
+}
+
+// definition of forward iterator yielding the tiles of a view as sub-views, row of tiles by row of tiles;
+// tiles on the bottom and right edges are clipped to the view
+
+template<typename _View>
+class _MdTileIterator {
+public:
+    using _Self = _MdTileIterator<_View>;
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = _View;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = _View;
+
+    // ctors
+    constexpr _MdTileIterator() : _view(), _tileRows(1), _tileCols(1), _row(0), _col(0) {}
+
+    constexpr _MdTileIterator(const _View& view, size_t tileRows, size_t tileCols, size_t row)
+        : _view(view), _tileRows(tileRows), _tileCols(tileCols), _row(row), _col(0) {}
+
+    // operator overloads
+    constexpr bool operator==(const _Self& right) const {
+        return _row == right._row && _col == right._col;
+    }
+
+    constexpr _View operator*() const {
+        return _view.subview(_row, _col, std::min(_tileRows, _view.rows() - _row), std::min(_tileCols, _view.cols() - _col));
+    }
+
+    // the position of the current tile within the view
+    constexpr size_t row() const {
+        return _row;
+    }
+
+    constexpr size_t col() const {
+        return _col;
+    }
+
+    // iterator increment
+    constexpr _Self& operator++() { // prefix
+        _col += _tileCols;
+        if (_col >= _view.cols()) {
+            _col = 0;
+            _row += _tileRows;
+        }
+
+        return *this;
+    }
+
+    constexpr _Self operator++(int) { // postfix
+        _Self tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+private:
+    _View _view;
+    size_t _tileRows;
+    size_t _tileCols;
+    size_t _row; // the top left element of the current tile
+    size_t _col;
+};
+
+template<typename _View>
+class _MdTileRange {
+public:
+    using iterator = _MdTileIterator<_View>;
+
+    constexpr _MdTileRange(const _View& view, size_t tileRows, size_t tileCols)
+        : _view(view), _tileRows(tileRows), _tileCols(tileCols) {}
+
+    constexpr iterator begin() const {
+        return iterator(_view, _tileRows, _tileCols, 0);
+    }
+
+    constexpr iterator end() const {
+        // past the last row of tiles; an empty view has no tiles at all
+        const size_t lastRow = _view.empty() ? 0 : (_view.rows() + _tileRows - 1) / _tileRows * _tileRows;
+        return iterator(_view, _tileRows, _tileCols, lastRow);
+    }
+
+private:
+    _View _view;
+    size_t _tileRows;
+    size_t _tileCols;
+};
+
+#endif // !MDVIEW_H
@@ -0,0 +1,169 @@
+#include <iostream>
+#include <iomanip>
+
+#include "MdView.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const char* name, double nanoseconds) {
+    std::cout << std::left << std::setw(52) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << nanoseconds << " ns/element" << std::endl;
+}
+
+constexpr size_t SIDE = 2048; // 16 MiB per float matrix, well beyond the last-level cache
+constexpr size_t REPEATS = 4;
+constexpr size_t TILE = constants::MDVIEW_DEFAULT_TILE;
+
+using Extents = Extents2D<SIDE, SIDE>;
+
+template<typename _Layout>
+using View = MdView<float, Extents, _Layout>;
+
+template<typename _Layout>
+Vector<float> makeStorage() {
+    Vector<float> storage(View<_Layout>::required_span_size(Extents()));
+
+    View<_Layout> view(storage);
+    for (size_t row = 0; row < SIDE; row++) {
+        for (size_t col = 0; col < SIDE; col++) {
+            view(row, col) = static_cast<float>((row * 7 + col * 3) % 101);
+        }
+    }
+
+    return storage;
+}
+
+// transpose element by element in the row order of the source
+template<typename _Layout>
+double transposeByRows() {
+    Vector<float> source = makeStorage<_Layout>();
+    Vector<float> destination = makeStorage<_Layout>();
+    View<_Layout> src(source), dst(destination);
+
+    const double ns = measureNs(REPEATS, [&] {
+        for (size_t row = 0; row < SIDE; row++) {
+            for (size_t col = 0; col < SIDE; col++) {
+                dst(col, row) = src(row, col);
+            }
+        }
+        doNotOptimize(destination);
+    });
+
+    return ns / (SIDE * SIDE);
+}
+
+// transpose tile by tile: a source tile and its mirrored destination tile both stay in cache
+template<typename _Layout>
+double transposeByTiles() {
+    Vector<float> source = makeStorage<_Layout>();
+    Vector<float> destination = makeStorage<_Layout>();
+    View<_Layout> src(source), dst(destination);
+
+    const double ns = measureNs(REPEATS, [&] {
+        const auto tiles = src.tiles(TILE, TILE);
+        for (auto it = tiles.begin(); it != tiles.end(); ++it) {
+            const View<_Layout> from = *it;
+            const View<_Layout> to = dst.subview(it.col(), it.row(), from.cols(), from.rows());
+
+            for (size_t row = 0; row < from.rows(); row++) {
+                for (size_t col = 0; col < from.cols(); col++) {
+                    to(col, row) = from(row, col);
+                }
+            }
+        }
+        doNotOptimize(destination);
+    });
+
+    return ns / (SIDE * SIDE);
+}
+
+// 5-point stencil over the interior, visiting the elements in the given order
+template<typename _Layout>
+inline void stencilAt(const View<_Layout>& src, const View<_Layout>& dst, size_t row, size_t col) {
+    dst(row, col) = 0.2f * (src(row, col) + src(row - 1, col) + src(row + 1, col) + src(row, col - 1) + src(row, col + 1));
+}
+
+template<typename _Layout>
+double stencilByRows() {
+    Vector<float> source = makeStorage<_Layout>();
+    Vector<float> destination = makeStorage<_Layout>();
+    View<_Layout> src(source), dst(destination);
+
+    const double ns = measureNs(REPEATS, [&] {
+        for (size_t row = 1; row + 1 < SIDE; row++) {
+            for (size_t col = 1; col + 1 < SIDE; col++) {
+                stencilAt(src, dst, row, col);
+            }
+        }
+        doNotOptimize(destination);
+    });
+
+    return ns / (SIDE * SIDE);
+}
+
+// column sweeps, as in the vertical pass of a separable or ADI scheme
+template<typename _Layout>
+double stencilByColumns() {
+    Vector<float> source = makeStorage<_Layout>();
+    Vector<float> destination = makeStorage<_Layout>();
+    View<_Layout> src(source), dst(destination);
+
+    const double ns = measureNs(REPEATS, [&] {
+        for (size_t col = 1; col + 1 < SIDE; col++) {
+            for (size_t row = 1; row + 1 < SIDE; row++) {
+                stencilAt(src, dst, row, col);
+            }
+        }
+        doNotOptimize(destination);
+    });
+
+    return ns / (SIDE * SIDE);
+}
+
+// tile by tile, and within each tile in whichever order: a tile and its halo fit in the cache
+template<typename _Layout>
+double stencilByTiles() {
+    Vector<float> source = makeStorage<_Layout>();
+    Vector<float> destination = makeStorage<_Layout>();
+    View<_Layout> src(source), dst(destination);
+
+    const double ns = measureNs(REPEATS, [&] {
+        const auto tiles = src.subview(1, 1, SIDE - 2, SIDE - 2).tiles(TILE, TILE);
+        for (auto it = tiles.begin(); it != tiles.end(); ++it) {
+            const View<_Layout> tile = *it;
+
+            for (size_t col = 0; col < tile.cols(); col++) {
+                for (size_t row = 0; row < tile.rows(); row++) {
+                    stencilAt(src, dst, 1 + it.row() + row, 1 + it.col() + col);
+                }
+            }
+        }
+        doNotOptimize(destination);
+    });
+
+    return ns / (SIDE * SIDE);
+}
+
+int main() {
+    std::cout << "TRANSPOSE, " << SIDE << " x " << SIDE << " floats\n" << std::endl;
+
+    printRow("LayoutRowMajor, row order", transposeByRows<LayoutRowMajor>());
+    printRow("LayoutRowMajor, 16 x 16 tile order", transposeByTiles<LayoutRowMajor>());
+    printRow("LayoutTiled<16, 16>, row order", transposeByRows<LayoutTiled<>>());
+    printRow("LayoutTiled<16, 16>, tile order", transposeByTiles<LayoutTiled<>>());
+    printRow("LayoutMorton, row order", transposeByRows<LayoutMorton>());
+    printRow("LayoutMorton, 16 x 16 tile order", transposeByTiles<LayoutMorton>());
+
+    std::cout << "\n5-POINT STENCIL, " << SIDE << " x " << SIDE << " floats\n" << std::endl;
+
+    printRow("LayoutRowMajor, row order", stencilByRows<LayoutRowMajor>());
+    printRow("LayoutRowMajor, column order", stencilByColumns<LayoutRowMajor>());
+    printRow("LayoutRowMajor, 16 x 16 tiles, column order inside", stencilByTiles<LayoutRowMajor>());
+    printRow("LayoutTiled<16, 16>, row order", stencilByRows<LayoutTiled<>>());
+    printRow("LayoutTiled<16, 16>, column order", stencilByColumns<LayoutTiled<>>());
+    printRow("LayoutTiled<16, 16>, tiles, column order inside", stencilByTiles<LayoutTiled<>>());
+    printRow("LayoutMorton, row order", stencilByRows<LayoutMorton>());
+    printRow("LayoutMorton, column order", stencilByColumns<LayoutMorton>());
+
+    return 0;
+}
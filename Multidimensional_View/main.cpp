@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+
+#include "MdView.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Static_Array/Array.h"
+
+// compile-time extents over an Array, usable in constant expressions
+constexpr float traceOf3x3() {
+    Array<float, 9> storage{};
+    MdView<float, Extents2D<3, 3>> matrix(storage);
+
+    for (size_t i = 0; i < 3; i++) {
+        matrix(i, i) = static_cast<float>(i + 1);
+    }
+
+    return matrix(0, 0) + matrix(1, 1) + matrix(2, 2);
+}
+
+static_assert(traceOf3x3() == 6.0f);
+static_assert(MdView<int, Extents2D<>, LayoutTiled<4, 4>>::required_span_size(Extents2D<>(5, 6)) == 8 * 8);
+static_assert(MdView<int, Extents2D<>, LayoutMorton>::required_span_size(Extents2D<>(5, 3)) == 8 * 8);
+
+// prints the storage offset of every element, which shows the order a layout keeps them in
+template<typename _View>
+void printOffsets(std::ofstream& file, const char* name, const _View& view) {
+    file << name << std::endl;
+    for (size_t row = 0; row < view.rows(); row++) {
+        for (size_t col = 0; col < view.cols(); col++) {
+            file << std::setw(4) << &view(row, col) - view.data_handle();
+        }
+        file << std::endl;
+    }
+    file << std::endl;
+}
+
+template<typename _View>
+void printElements(std::ofstream& file, const _View& view) {
+    for (size_t row = 0; row < view.rows(); row++) {
+        for (size_t col = 0; col < view.cols(); col++) {
+            file << std::setw(5) << view(row, col);
+        }
+        file << std::endl;
+    }
+}
+
+int main() {
+    std::ofstream myMdViewTestFile("MdViewTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myMdViewTestFile << "MULTIDIMENSIONAL VIEW LAYOUTS\n" << std::endl;
+
+    // the same 8 x 8 extents under each layout
+    {
+        const Extents2D<8, 8> extents;
+        Vector<int> storage(64);
+
+        printOffsets(myMdViewTestFile, "LayoutRowMajor", MdView<int, Extents2D<8, 8>, LayoutRowMajor>(storage, extents));
+        printOffsets(myMdViewTestFile, "LayoutColumnMajor", MdView<int, Extents2D<8, 8>, LayoutColumnMajor>(storage, extents));
+        printOffsets(myMdViewTestFile, "LayoutTiled<4, 4>", MdView<int, Extents2D<8, 8>, LayoutTiled<4, 4>>(storage, extents));
+        printOffsets(myMdViewTestFile, "LayoutMorton", MdView<int, Extents2D<8, 8>, LayoutMorton>(storage, extents));
+    }
+
+    myMdViewTestFile << "SUB-VIEWS AND TILES\n" << std::endl;
+
+    // runtime extents over a Vector, sub-views and tile iteration
+    {
+        const Extents2D<> extents(5, 7);
+        using TiledView = MdView<int, Extents2D<>, LayoutTiled<2, 4>>;
+
+        Vector<int> storage(TiledView::required_span_size(extents));
+        TiledView image(storage, extents);
+
+        for (size_t row = 0; row < image.rows(); row++) {
+            for (size_t col = 0; col < image.cols(); col++) {
+                image(row, col) = static_cast<int>(row * 10 + col);
+            }
+        }
+        myMdViewTestFile << "5 x 7 image, LayoutTiled<2, 4>, storage of " << storage.size() << " elements" << std::endl;
+        printElements(myMdViewTestFile, image);
+
+        TiledView window = image.subview(1, 2, 3, 4);
+        myMdViewTestFile << "\nsubview(1, 2, 3, 4)" << std::endl;
+        printElements(myMdViewTestFile, window);
+
+        myMdViewTestFile << "\nthe layout's own tiles:" << std::endl;
+        for (auto it = image.tiles().begin(); it != image.tiles().end(); ++it) {
+            const TiledView tile = *it;
+            myMdViewTestFile << "tile at (" << it.row() << ", " << it.col() << ") is " << tile.rows() << " x " << tile.cols()
+                             << ", starts with " << tile(0, 0) << std::endl;
+        }
+
+        try {
+            image.at(5, 0);
+        } catch (const std::out_of_range& error) {
+            myMdViewTestFile << "\nat(5, 0) threw: " << error.what() << std::endl;
+        }
+
+        try {
+            Vector<int> tooSmall(35);
+            TiledView view(tooSmall, extents);
+        } catch (const std::length_error& error) {
+            myMdViewTestFile << "35 elements for a tiled 5 x 7 view threw: " << error.what() << std::endl;
+        }
+    }
+
+    myMdViewTestFile.close();
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#ifndef SHARDEDCOUNTER_H
+#define SHARDEDCOUNTER_H
+
+#include <sched.h>
+
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <functional>
+
+#include "../Static_Array/AlignedArray.h"
+
+namespace constants {
+    constexpr size_t DEFAULT_COUNTER_SHARDS = 64;
+}
+
+// interface of a counter split into per-core shards, each on its own cache line.
+// Writers increment the shard of the core they currently run on with a relaxed atomic, so concurrent
+// writers on different cores never contend for the same cache line. Readers sum all shards; the sum is
+// exact once writers are quiescent and otherwise a value the counter held at some point during the read.
+// Cores beyond _Shards wrap around and share shards, which is still correct, only less scalable.
+
+template<size_t _Shards = constants::DEFAULT_COUNTER_SHARDS>
+class ShardedCounter {
+public:
+    static_assert(_Shards > 0 && (_Shards & (_Shards - 1)) == 0, "ShardedCounter Error: Shard count must be a power of two!");
+
+    // ctors
+    ShardedCounter();
+
+    ShardedCounter(const ShardedCounter& source) = delete;
+
+    // operator=
+    ShardedCounter& operator=(const ShardedCounter& right) = delete;
+
+    // modifiers
+    void add(uint64_t value = 1);
+
+    void reset();
+
+    // observers
+    uint64_t read() const;
+
+    static constexpr size_t shards();
+
+private:
+    static size_t _currentShard();
+
+private:
+    AlignedArray<std::atomic<uint64_t>, _Shards> _slots; // one padded relaxed counter per core
+};
+
+// ShardedCounter definition
+
+template<size_t _Shards>
+size_t ShardedCounter<_Shards>::_currentShard() {
+    const int cpu = sched_getcpu();
+
+    if (cpu >= 0) {
+        return static_cast<size_t>(cpu) & (_Shards - 1);
+    }
+
+    // sched_getcpu() is unsupported: spread the threads by identity instead
+    thread_local const size_t threadShard = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return threadShard & (_Shards - 1);
+}
+
+template<size_t _Shards>
+ShardedCounter<_Shards>::ShardedCounter() {
+    reset();
+}
+
+template<size_t _Shards>
+void ShardedCounter<_Shards>::add(uint64_t value) {
+    // the thread may migrate between sched_getcpu() and the increment, which only costs some sharing
+    _slots[_currentShard()].fetch_add(value, std::memory_order_relaxed);
+}
+
+template<size_t _Shards>
+void ShardedCounter<_Shards>::reset() {
+    for (auto& slot : _slots) {
+        slot.store(0, std::memory_order_relaxed);
+    }
+}
+
+template<size_t _Shards>
+uint64_t ShardedCounter<_Shards>::read() const {
+    uint64_t sum = 0;
+    for (auto it = _slots.cbegin(); it != _slots.cend(); ++it) {
+        sum += it->load(std::memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+template<size_t _Shards>
+constexpr size_t ShardedCounter<_Shards>::shards() {
+    return _Shards;
+}
+
+#endif // !SHARDEDCOUNTER_H
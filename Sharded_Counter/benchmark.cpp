@@ -0,0 +1,97 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "ShardedCounter.h"
+
+constexpr size_t MAX_THREADS = 64;
+constexpr size_t TOTAL_INCREMENTS = 1 << 24;
+
+// runs body(threadIndex) on threadsCount threads released together, returns nanoseconds per increment
+template<typename Body>
+double runThreads(size_t threadsCount, Body&& body) {
+    std::atomic<bool> go{ false };
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadsCount; t++) {
+        threads.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            body(t);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / TOTAL_INCREMENTS;
+}
+
+void printRow(const char* name, size_t threadsCount, double nanoseconds, uint64_t result) {
+    std::cout << std::left << std::setw(34) << name << std::right << std::setw(4) << threadsCount << " threads"
+              << std::setw(10) << std::fixed << std::setprecision(2) << nanoseconds << " ns/op"
+              << std::setw(10) << std::setprecision(1) << 1e3 / nanoseconds << " Mops/s"
+              << "   (count " << result << ")" << std::endl;
+}
+
+int main() {
+    std::cout << "COUNTER CONTENTION (" << TOTAL_INCREMENTS << " increments split across the threads, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+    for (size_t threadsCount = 1; threadsCount <= MAX_THREADS; threadsCount *= 2) {
+        const size_t perThread = TOTAL_INCREMENTS / threadsCount;
+
+        std::atomic<uint64_t> single{ 0 };
+        double ns = runThreads(threadsCount, [&](size_t) {
+            for (size_t i = 0; i < perThread; i++) {
+                single.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        printRow("single std::atomic", threadsCount, ns, single.load());
+
+        ShardedCounter<> sharded;
+        ns = runThreads(threadsCount, [&](size_t) {
+            for (size_t i = 0; i < perThread; i++) {
+                sharded.add();
+            }
+        });
+        printRow("ShardedCounter", threadsCount, ns, sharded.read());
+
+        // per-thread slots: adjacent in Array, each on its own cache line in AlignedArray
+        Array<std::atomic<uint64_t>, MAX_THREADS> packed{};
+        ns = runThreads(threadsCount, [&](size_t t) {
+            for (size_t i = 0; i < perThread; i++) {
+                packed[t].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        uint64_t sum = 0;
+        for (auto& slot : packed) {
+            sum += slot.load();
+        }
+        printRow("per-thread slots in Array", threadsCount, ns, sum);
+
+        AlignedArray<std::atomic<uint64_t>, MAX_THREADS> padded{};
+        ns = runThreads(threadsCount, [&](size_t t) {
+            for (size_t i = 0; i < perThread; i++) {
+                padded[t].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        sum = 0;
+        for (auto& slot : padded) {
+            sum += slot.load();
+        }
+        printRow("per-thread slots in AlignedArray", threadsCount, ns, sum);
+
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "ShardedCounter.h"
+
+int main() {
+    std::ofstream myCounterTestFile("ShardedCounterTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myCounterTestFile << "SHARDED COUNTER\n" << std::endl;
+
+    // single-threaded use
+    {
+        ShardedCounter<> counter;
+
+        myCounterTestFile << "ShardedCounter::shards() = " << counter.shards() << std::endl;
+        myCounterTestFile << "Initial read() = " << counter.read() << std::endl;
+
+        for (unsigned i = 0; i < 10; i++) {
+            counter.add();
+        }
+        counter.add(90);
+
+        myCounterTestFile << "read() after 10 add() and add(90) = " << counter.read() << std::endl;
+
+        counter.reset();
+        myCounterTestFile << "read() after reset() = " << counter.read() << std::endl;
+    }
+
+    // concurrent increments
+    {
+        const unsigned threadsCount = 8;
+        const unsigned incrementsPerThread = 100000;
+
+        ShardedCounter<8> counter;
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < threadsCount; t++) {
+            threads.emplace_back([&counter] {
+                for (unsigned i = 0; i < incrementsPerThread; i++) {
+                    counter.add();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        myCounterTestFile << "\n8 threads x 100000 add() on ShardedCounter<8>, read() = " << counter.read() << std::endl;
+    }
+
+    // AlignedArray element placement
+    {
+        AlignedArray<uint64_t, 4> slots;
+        slots.fill(7);
+
+        myCounterTestFile << "\nAlignedArray<uint64_t, 4> with every element set to 7" << std::endl;
+        for (size_t i = 0; i < slots.size(); i++) {
+            myCounterTestFile << "slot " << i << " = " << slots[i] << ", offset from slot 0: "
+                              << reinterpret_cast<const char*>(&slots[i]) - reinterpret_cast<const char*>(&slots[0])
+                              << " bytes" << std::endl;
+        }
+    }
+
+    myCounterTestFile.close();
+
+    return 0;
+}
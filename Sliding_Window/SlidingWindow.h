@@ -0,0 +1,216 @@
+#ifndef SLIDINGWINDOW_H
+#define SLIDINGWINDOW_H
+
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+#include "../Double_Ended_Queue/Deque.h"
+
+// aggregation operators of the SlidingWindow.
+// A monoid has an associative operator() and a static identity() it leaves every value unchanged with;
+// it need not be commutative, the window always combines older with newer. A selection instead names in
+// selects the order that picks its result out of two operands, the window then keeps a monotonic deque.
+
+template<typename _Type>
+struct SumOp {
+    static _Type identity() {
+        return _Type();
+    }
+
+    _Type operator()(const _Type& older, const _Type& newer) const {
+        return older + newer;
+    }
+};
+
+template<typename _Type>
+struct MinOp {
+    using selects = std::less<_Type>;
+};
+
+template<typename _Type>
+struct MaxOp {
+    using selects = std::greater<_Type>;
+};
+
+template<typename _Op>
+concept _IsSelection = requires { typename _Op::selects; };
+
+// interface of an aggregate over a sliding window, e.g. the rolling minimum or sum of a metric.
+// Values enter at the newest end with push() and leave at the oldest end with evict(); query() returns
+// the aggregate of the values in between, all three in amortized O(1) instead of a rescan of the window.
+// For a selection only the candidates are kept: values that no newer value beats, in a monotonic ring
+// Deque. For a monoid the window is split in an older and a newer part: the newer part keeps its values
+// and their running aggregate, the older part only suffix aggregates, so its front is the aggregate
+// of the whole older part. Once the older part is used up, the newer part is folded into it from the
+// newest value to the oldest with push_front() on the Deque.
+// A window constructed with a length evicts by itself once it holds that many values.
+
+template<typename _Type, typename _Op>
+class SlidingWindow {
+public:
+    using value_type = _Type;
+    using size_type = size_t;
+
+    // ctors
+    explicit SlidingWindow(size_t length = 0, _Op op = _Op());
+
+    // capacity
+    bool empty() const;
+
+    size_t size() const;
+
+    // the length the window keeps, 0 if it is only shrunk by evict()
+    size_t length() const;
+
+    // modifiers
+    void push(const _Type& value);
+
+    // drops the oldest value
+    void evict();
+
+    void clear();
+
+    // the aggregate of the window, identity() for an empty window of a monoid
+    _Type query() const;
+
+private:
+    struct _Candidate {
+        size_t _sequence; // the number of values pushed before this one
+        _Type _value;
+    };
+
+    struct _SelectionState {
+        Deque<_Candidate> _candidates; // ordered by _Op::selects from the front
+        size_t _pushed = 0;
+        size_t _evicted = 0;
+    };
+
+    struct _MonoidState {
+        Deque<_Type> _older; // suffix aggregates of the older part, the front covers all of it
+        Deque<_Type> _newer; // values of the newer part
+        _Type _newerAggregate;
+    };
+
+    void _foldNewerIntoOlder();
+
+private:
+    std::conditional_t<_IsSelection<_Op>, _SelectionState, _MonoidState> _state;
+    size_t _length;
+    [[no_unique_address]] _Op _op;
+};
+
+// SlidingWindow definition
+
+template<typename _Type, typename _Op>
+SlidingWindow<_Type, _Op>::SlidingWindow(size_t length, _Op op) : _state(), _length(length), _op(std::move(op)) {
+    if constexpr (!_IsSelection<_Op>) {
+        _state._newerAggregate = _Op::identity();
+    }
+}
+
+template<typename _Type, typename _Op>
+bool SlidingWindow<_Type, _Op>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type, typename _Op>
+size_t SlidingWindow<_Type, _Op>::size() const {
+    if constexpr (_IsSelection<_Op>) {
+        return _state._pushed - _state._evicted;
+    } else {
+        return _state._older.size() + _state._newer.size();
+    }
+}
+
+template<typename _Type, typename _Op>
+size_t SlidingWindow<_Type, _Op>::length() const {
+    return _length;
+}
+
+template<typename _Type, typename _Op>
+void SlidingWindow<_Type, _Op>::push(const _Type& value) {
+    if (_length != 0 && size() == _length) {
+        evict();
+    }
+
+    if constexpr (_IsSelection<_Op>) {
+        // candidates the new value beats or equals can never be the answer again, it outlives them
+        const typename _Op::selects selects;
+        Deque<_Candidate>& candidates = _state._candidates;
+        while (!candidates.empty() && !selects(candidates.back()._value, value)) {
+            candidates.pop_back();
+        }
+        candidates.push_back({ _state._pushed++, value });
+    } else {
+        _state._newer.push_back(value);
+        _state._newerAggregate = _op(_state._newerAggregate, value);
+    }
+}
+
+template<typename _Type, typename _Op>
+void SlidingWindow<_Type, _Op>::evict() {
+    if (empty()) {
+        throw std::out_of_range("SlidingWindow Error: Evict from an empty window!");
+    }
+
+    if constexpr (_IsSelection<_Op>) {
+        // the oldest value is still a candidate only if nothing newer beat it
+        if (_state._candidates.front()._sequence == _state._evicted) {
+            _state._candidates.pop_front();
+        }
+        _state._evicted++;
+    } else {
+        if (_state._older.empty()) {
+            _foldNewerIntoOlder();
+        }
+        _state._older.pop_front();
+    }
+}
+
+template<typename _Type, typename _Op>
+void SlidingWindow<_Type, _Op>::clear() {
+    if constexpr (_IsSelection<_Op>) {
+        _state._candidates.clear();
+        _state._evicted = _state._pushed;
+    } else {
+        _state._older.clear();
+        _state._newer.clear();
+        _state._newerAggregate = _Op::identity();
+    }
+}
+
+template<typename _Type, typename _Op>
+_Type SlidingWindow<_Type, _Op>::query() const {
+    if constexpr (_IsSelection<_Op>) {
+        if (empty()) {
+            throw std::out_of_range("SlidingWindow Error: Query of an empty window!");
+        }
+
+        return _state._candidates.front()._value;
+    } else {
+        if (_state._older.empty()) {
+            return _state._newerAggregate;
+        }
+
+        return _op(_state._older.front(), _state._newerAggregate);
+    }
+}
+
+template<typename _Type, typename _Op>
+void SlidingWindow<_Type, _Op>::_foldNewerIntoOlder() {
+    Deque<_Type>& newer = _state._newer;
+    Deque<_Type>& older = _state._older;
+
+    _Type suffix = _Op::identity();
+    for (size_t pos = newer.size(); pos-- > 0;) {
+        suffix = _op(newer[pos], suffix);
+        older.push_front(suffix);
+    }
+
+    newer.clear();
+    _state._newerAggregate = _Op::identity();
+}
+
+#endif // !SLIDINGWINDOW_H
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include "SlidingWindow.h"
+#include "../Utility/Benchmark.h"
+
+constexpr size_t SAMPLES = 1 << 22;
+// the rescans are cut to about this many element visits per window size, enough for a stable average
+constexpr size_t RESCAN_VISITS = size_t(1) << 29;
+
+struct Random {
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+
+    uint64_t operator()() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    }
+};
+
+// every sample is pushed and the aggregate queried, the window evicts by itself once full
+template<typename _Op>
+double slidingWindow(size_t length) {
+    SlidingWindow<uint64_t, _Op> window(length);
+    Random random;
+    for (size_t i = 0; i < length; i++) {
+        window.push(random() & 0xFFFF);
+    }
+
+    uint64_t checksum = 0;
+    const double ns = measureNs(SAMPLES, [&] {
+        window.push(random() & 0xFFFF);
+        checksum += window.query();
+    });
+    doNotOptimize(checksum);
+
+    return ns;
+}
+
+// baseline: the last length samples in a bounded ring Deque, rescanned on every query
+template<typename _Scan>
+double rescan(size_t length, _Scan scan) {
+    Deque<uint64_t> window(overwrite_oldest, length);
+    Random random;
+    for (size_t i = 0; i < length; i++) {
+        window.push_back(random() & 0xFFFF);
+    }
+
+    uint64_t checksum = 0;
+    const double ns = measureNs(std::max<size_t>(16, std::min(SAMPLES, RESCAN_VISITS / length)), [&] {
+        window.push_back(random() & 0xFFFF);
+        const auto spans = std::as_const(window).as_spans();
+        checksum += scan(scan(_Scan::identity, spans.first), spans.second);
+    });
+    doNotOptimize(checksum);
+
+    return ns;
+}
+
+// folds a region of the ring into the aggregate of the regions before it
+struct MinScan {
+    static constexpr uint64_t identity = UINT64_MAX;
+
+    uint64_t operator()(uint64_t aggregate, std::span<const uint64_t> region) const {
+        for (uint64_t value : region) {
+            aggregate = std::min(aggregate, value);
+        }
+        return aggregate;
+    }
+};
+
+struct SumScan {
+    static constexpr uint64_t identity = 0;
+
+    uint64_t operator()(uint64_t aggregate, std::span<const uint64_t> region) const {
+        for (uint64_t value : region) {
+            aggregate += value;
+        }
+        return aggregate;
+    }
+};
+
+int main() {
+    std::cout << "PUSH + QUERY PER SAMPLE, ns (" << SAMPLES << " samples through every SlidingWindow)\n" << std::endl;
+    std::cout << std::setw(10) << "window" << std::setw(16) << "rescan min" << std::setw(16) << "MinOp"
+              << std::setw(16) << "MaxOp" << std::setw(16) << "rescan sum" << std::setw(16) << "SumOp" << std::endl;
+
+    for (size_t length : { 10, 100, 1000, 10000, 100000, 1000000 }) {
+        std::cout << std::setw(10) << length << std::fixed << std::setprecision(2)
+                  << std::setw(16) << rescan(length, MinScan())
+                  << std::setw(16) << slidingWindow<MinOp<uint64_t>>(length)
+                  << std::setw(16) << slidingWindow<MaxOp<uint64_t>>(length)
+                  << std::setw(16) << rescan(length, SumScan())
+                  << std::setw(16) << slidingWindow<SumOp<uint64_t>>(length) << std::endl;
+    }
+
+    return 0;
+}
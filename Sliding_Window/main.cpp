@@ -0,0 +1,117 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+
+#include "SlidingWindow.h"
+
+// a non-commutative monoid: x -> a * x + b, composed so that the older function is applied first
+struct Affine {
+    int64_t a = 1;
+    int64_t b = 0;
+};
+
+struct ComposeOp {
+    static Affine identity() {
+        return {};
+    }
+
+    Affine operator()(const Affine& older, const Affine& newer) const {
+        return { newer.a * older.a, newer.a * older.b + newer.b };
+    }
+};
+
+template<typename _Type, typename _Op>
+void writeQuery(const SlidingWindow<_Type, _Op>& window, std::ofstream& tFile) {
+    tFile << " size() = " << window.size() << ", query() = " << window.query() << std::endl;
+}
+
+int main() {
+    std::ofstream mySlidingWindowTestFile("SlidingWindowTests.txt", std::ofstream::out | std::ios::trunc);
+
+    mySlidingWindowTestFile << "SLIDING WINDOW\n" << std::endl;
+
+    const int samples[] = { 5, 3, 8, 1, 9, 2, 7, 4, 6, 0 };
+
+    {
+        SlidingWindow<int, MinOp<int>> windowMin(4);
+        SlidingWindow<int, MaxOp<int>> windowMax(4);
+        SlidingWindow<int, SumOp<int>> windowSum(4);
+
+        mySlidingWindowTestFile << "Windows of length 4 over 5 3 8 1 9 2 7 4 6 0" << std::endl;
+        for (int sample : samples) {
+            windowMin.push(sample);
+            windowMax.push(sample);
+            windowSum.push(sample);
+
+            mySlidingWindowTestFile << "push(" << sample << "): min = " << windowMin.query() << ", max = " << windowMax.query()
+                                    << ", sum = " << windowSum.query() << ", size() = " << windowSum.size() << std::endl;
+        }
+    }
+
+    {
+        SlidingWindow<int, SumOp<int>> windowSum;
+
+        mySlidingWindowTestFile << "\nWindow without a length, evicted by hand" << std::endl;
+        mySlidingWindowTestFile << "empty window:";
+        writeQuery(windowSum, mySlidingWindowTestFile);
+
+        for (int sample : samples) {
+            windowSum.push(sample);
+        }
+        mySlidingWindowTestFile << "push() all 10 samples:";
+        writeQuery(windowSum, mySlidingWindowTestFile);
+
+        for (int i = 0; i < 7; i++) {
+            windowSum.evict();
+        }
+        mySlidingWindowTestFile << "evict() 7 times:";
+        writeQuery(windowSum, mySlidingWindowTestFile);
+
+        windowSum.clear();
+        mySlidingWindowTestFile << "clear():";
+        writeQuery(windowSum, mySlidingWindowTestFile);
+
+        try {
+            windowSum.evict();
+        } catch (const std::out_of_range& e) {
+            mySlidingWindowTestFile << "evict() on the empty window: " << e.what() << std::endl;
+        }
+    }
+
+    {
+        // the window applies its functions oldest first, so the order of the samples matters
+        SlidingWindow<Affine, ComposeOp> composed(3);
+
+        mySlidingWindowTestFile << "\nWindow of length 3 composing x -> 2x + 1, x -> x + 10, x -> 3x, x -> x - 4" << std::endl;
+        const Affine functions[] = { { 2, 1 }, { 1, 10 }, { 3, 0 }, { 1, -4 } };
+        for (const Affine& function : functions) {
+            composed.push(function);
+            const Affine result = composed.query();
+            mySlidingWindowTestFile << "push(" << function.a << "x + " << function.b << "): window maps 1 to "
+                                    << result.a * 1 + result.b << std::endl;
+        }
+    }
+
+    {
+        // a time window: samples older than 10 ticks are evicted before each query
+        SlidingWindow<int, MaxOp<int>> recentPeak;
+        Deque<int> timestamps;
+
+        mySlidingWindowTestFile << "\nPeak over the last 10 ticks, a sample every 3 ticks" << std::endl;
+        for (int tick = 0, i = 0; i < 10; tick += 3, i++) {
+            recentPeak.push(samples[i]);
+            timestamps.push_back(tick);
+            while (timestamps.front() <= tick - 10) {
+                timestamps.pop_front();
+                recentPeak.evict();
+            }
+            mySlidingWindowTestFile << "tick " << tick << ", sample " << samples[i] << ":";
+            writeQuery(recentPeak, mySlidingWindowTestFile);
+        }
+    }
+
+    mySlidingWindowTestFile.close();
+
+    return 0;
+}
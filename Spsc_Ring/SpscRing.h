@@ -0,0 +1,256 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+#include "../Utility/CacheLine.h"
+
+namespace constants {
+    constexpr size_t DEFAULT_SPSC_RING_CAPACITY = 1024;
+}
+
+// interface of a lock-free single-producer single-consumer queue.
+// It keeps the layout of the ring Deque: a power-of-two circular buffer indexed with a mask, the
+// producer appends at _tail and the consumer takes from _head. Both indices run freely and are masked
+// on access, so all capacity() slots are usable. Each index is written by one thread only and sits on
+// its own cache line together with that thread's cached copy of the other index; a side reloads the
+// other index (acquire) only when its cached copy shows too little room or too few elements, so in
+// steady state the two threads do not share a written cache line. Slots stay uninitialized until
+// pushed into.
+// Exactly one thread may call the push members and exactly one thread the pop members.
+
+template<typename _Type>
+class SpscRing {
+public:
+    using value_type = _Type;
+    using size_type = size_t;
+
+    // ctors
+    explicit SpscRing(size_t capacity = constants::DEFAULT_SPSC_RING_CAPACITY);
+
+    SpscRing(const SpscRing& source) = delete;
+
+    // dtor, must not run concurrently with any other member
+    ~SpscRing();
+
+    // operator=
+    SpscRing& operator=(const SpscRing& right) = delete;
+
+    // capacity, exact only on the producer or the consumer thread
+    bool empty() const;
+
+    size_t size() const;
+
+    size_t capacity() const;
+
+    // modifiers of the producer thread, false or a short count when the ring is full
+    bool try_push(const _Type& value);
+    bool try_push(_Type&& value);
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    // pushes up to count elements from first and publishes them at once, returns how many were pushed;
+    // if constructing one of them throws, none is pushed
+    template<typename InputIt>
+    size_t try_push_n(InputIt first, size_t count);
+
+    // modifiers of the consumer thread, false or a short count when the ring is empty
+    bool try_pop(_Type& value);
+
+    // moves up to count elements to dest and releases their slots at once, returns how many were popped;
+    // if assigning one of them throws, the ones before it are popped and the rest stay in the ring
+    template<typename OutputIt>
+    size_t try_pop_n(OutputIt dest, size_t count);
+
+private:
+    _Type* _slot(size_t pos) const;
+
+    // free slots at tail, rereads _head only if the cached copy shows fewer than wanted
+    size_t _freeSlots(size_t tail, size_t wanted);
+
+    // published elements at head, rereads _tail only if the cached copy shows fewer than wanted
+    size_t _readySlots(size_t head, size_t wanted);
+
+private:
+    // producer line
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<size_t> _tail; // next slot to push into
+    size_t _cachedHead; // the producer's last view of _head
+
+    // consumer line
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<size_t> _head; // next slot to pop from
+    size_t _cachedTail; // the consumer's last view of _tail
+
+    // read-only after construction
+    alignas(constants::CACHE_LINE_SIZE) size_t _mask;
+    _Type* _slots;
+};
+
+// SpscRing definition
+
+template<typename _Type>
+SpscRing<_Type>::SpscRing(size_t capacity) :
+    _tail(0), _cachedHead(0), _head(0), _cachedTail(0), _mask(std::bit_ceil(std::max<size_t>(capacity, 1)) - 1),
+    _slots(static_cast<_Type*>(::operator new((_mask + 1) * sizeof(_Type), std::align_val_t(alignof(_Type))))) {}
+
+template<typename _Type>
+SpscRing<_Type>::~SpscRing() {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    for (size_t pos = _head.load(std::memory_order_relaxed); pos != tail; pos++) {
+        _slot(pos)->~_Type();
+    }
+
+    ::operator delete(_slots, std::align_val_t(alignof(_Type)));
+}
+
+template<typename _Type>
+bool SpscRing<_Type>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type>
+size_t SpscRing<_Type>::size() const {
+    const size_t head = _head.load(std::memory_order_acquire);
+    const size_t tail = _tail.load(std::memory_order_acquire);
+
+    // _head is read first and never passes _tail, but pushes in between can take the difference past capacity()
+    return std::min(tail - head, capacity());
+}
+
+template<typename _Type>
+size_t SpscRing<_Type>::capacity() const {
+    return _mask + 1;
+}
+
+template<typename _Type>
+bool SpscRing<_Type>::try_push(const _Type& value) {
+    return try_emplace(value);
+}
+
+template<typename _Type>
+bool SpscRing<_Type>::try_push(_Type&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename _Type>
+template<typename... Args>
+bool SpscRing<_Type>::try_emplace(Args&&... args) {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (_freeSlots(tail, 1) == 0) {
+        return false;
+    }
+
+    ::new(static_cast<void*>(_slot(tail))) _Type(std::forward<Args>(args)...);
+
+    // release: the element is constructed before the consumer can see the new tail
+    _tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename _Type>
+template<typename InputIt>
+size_t SpscRing<_Type>::try_push_n(InputIt first, size_t count) {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    count = std::min(count, _freeSlots(tail, count));
+
+    size_t constructed = 0;
+    try {
+        for (; constructed < count; ++constructed, ++first) {
+            ::new(static_cast<void*>(_slot(tail + constructed))) _Type(*first);
+        }
+    } catch (...) {
+        // nothing is published yet: destroy what this batch constructed and leave the ring as it was
+        for (size_t i = 0; i < constructed; i++) {
+            _slot(tail + i)->~_Type();
+        }
+        throw;
+    }
+
+    if (count > 0) {
+        _tail.store(tail + count, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template<typename _Type>
+bool SpscRing<_Type>::try_pop(_Type& value) {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (_readySlots(head, 1) == 0) {
+        return false;
+    }
+
+    _Type* element = _slot(head);
+    value = std::move(*element);
+    element->~_Type();
+
+    // release: the slot is vacated before the producer can reuse it
+    _head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename _Type>
+template<typename OutputIt>
+size_t SpscRing<_Type>::try_pop_n(OutputIt dest, size_t count) {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    count = std::min(count, _readySlots(head, count));
+
+    size_t popped = 0;
+    try {
+        for (; popped < count; ++popped, ++dest) {
+            _Type* element = _slot(head + popped);
+            *dest = std::move(*element);
+            element->~_Type();
+        }
+    } catch (...) {
+        // the slots before popped are destroyed already: release them, the one that threw stays in the ring
+        if (popped > 0) {
+            _head.store(head + popped, std::memory_order_release);
+        }
+        throw;
+    }
+
+    if (count > 0) {
+        _head.store(head + count, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template<typename _Type>
+_Type* SpscRing<_Type>::_slot(size_t pos) const {
+    return _slots + (pos & _mask);
+}
+
+template<typename _Type>
+size_t SpscRing<_Type>::_freeSlots(size_t tail, size_t wanted) {
+    size_t free = capacity() - (tail - _cachedHead);
+    if (free < wanted) {
+        // acquire: pairs with the consumer's release, the slots it vacated are done with
+        _cachedHead = _head.load(std::memory_order_acquire);
+        free = capacity() - (tail - _cachedHead);
+    }
+
+    return free;
+}
+
+template<typename _Type>
+size_t SpscRing<_Type>::_readySlots(size_t head, size_t wanted) {
+    size_t ready = _cachedTail - head;
+    if (ready < wanted) {
+        // acquire: pairs with the producer's release, the elements it published are constructed
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        ready = _cachedTail - head;
+    }
+
+    return ready;
+}
+
+#endif // !SPSCRING_H
@@ -0,0 +1,211 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <type_traits>
+
+#include "SpscRing.h"
+#include "../Double_Ended_Queue/Deque.h"
+
+constexpr uint64_t TRANSFERS = 1 << 22;
+constexpr size_t RING_CAPACITY = 1024;
+constexpr size_t BATCH = 32;
+constexpr size_t ROUND_TRIPS = 1 << 16;
+
+// baseline: the ring Deque behind one mutex
+class LockedRing {
+public:
+    LockedRing() {
+        _deque.reserve(RING_CAPACITY);
+    }
+
+    bool try_push(uint64_t value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.size() >= RING_CAPACITY) {
+            return false;
+        }
+        _deque.push_back(value);
+
+        return true;
+    }
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.empty()) {
+            return false;
+        }
+        value = _deque.front();
+        _deque.pop_front();
+
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    Deque<uint64_t> _deque;
+};
+
+// SpscRing with the capacity of the baseline, both sides move one element per call
+class SingleRing : public SpscRing<uint64_t> {
+public:
+    SingleRing() : SpscRing<uint64_t>(RING_CAPACITY) {}
+};
+
+// the same ring, but both sides move up to BATCH elements per call
+class BatchRing : public SpscRing<uint64_t> {
+public:
+    BatchRing() : SpscRing<uint64_t>(RING_CAPACITY) {}
+};
+
+// waiting sides yield, so the benchmark also makes progress when both threads share one core
+inline void backOff() {
+    std::this_thread::yield();
+}
+
+template<typename _Ring>
+void produce(_Ring& ring) {
+    if constexpr (std::is_same_v<_Ring, BatchRing>) {
+        uint64_t batch[BATCH];
+        for (uint64_t next = 1; next <= TRANSFERS;) {
+            const size_t count = std::min<uint64_t>(BATCH, TRANSFERS - next + 1);
+            for (size_t i = 0; i < count; i++) {
+                batch[i] = next + i;
+            }
+            for (size_t pushed = 0; pushed < count;) {
+                const size_t now = ring.try_push_n(batch + pushed, count - pushed);
+                pushed += now;
+                if (now == 0) {
+                    backOff();
+                }
+            }
+            next += count;
+        }
+    } else {
+        for (uint64_t next = 1; next <= TRANSFERS; next++) {
+            while (!ring.try_push(next)) {
+                backOff();
+            }
+        }
+    }
+}
+
+template<typename _Ring>
+uint64_t consume(_Ring& ring) {
+    uint64_t sum = 0;
+    if constexpr (std::is_same_v<_Ring, BatchRing>) {
+        uint64_t batch[BATCH];
+        for (uint64_t received = 0; received < TRANSFERS;) {
+            const size_t count = ring.try_pop_n(batch, BATCH);
+            for (size_t i = 0; i < count; i++) {
+                sum += batch[i];
+            }
+            received += count;
+            if (count == 0) {
+                backOff();
+            }
+        }
+    } else {
+        uint64_t value = 0;
+        for (uint64_t received = 0; received < TRANSFERS; received++) {
+            while (!ring.try_pop(value)) {
+                backOff();
+            }
+            sum += value;
+        }
+    }
+
+    return sum;
+}
+
+// one producer streams TRANSFERS elements to one consumer; returns millions of elements per second
+template<typename _Ring>
+double throughput(bool& checksumOk) {
+    _Ring ring;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread producer([&ring] {
+        produce(ring);
+    });
+    const uint64_t sum = consume(ring);
+    producer.join();
+    const auto stop = std::chrono::steady_clock::now();
+
+    checksumOk = sum == TRANSFERS * (TRANSFERS + 1) / 2;
+
+    return TRANSFERS / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+struct Latency {
+    double p50;
+    double p99;
+};
+
+// ping-pong through two rings: the main thread sends a value and waits for the echo; ns per round trip
+template<typename _Ring>
+Latency roundTrip() {
+    _Ring request, response;
+
+    std::thread echo([&] {
+        uint64_t value = 0;
+        for (size_t i = 0; i < ROUND_TRIPS; i++) {
+            while (!request.try_pop(value)) {
+                backOff();
+            }
+            while (!response.try_push(value)) {
+                backOff();
+            }
+        }
+    });
+
+    std::vector<double> samples(ROUND_TRIPS);
+    uint64_t value = 0;
+    for (size_t i = 0; i < ROUND_TRIPS; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        while (!request.try_push(i)) {
+            backOff();
+        }
+        while (!response.try_pop(value)) {
+            backOff();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        samples[i] = std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+    echo.join();
+
+    std::sort(samples.begin(), samples.end());
+
+    return { samples[ROUND_TRIPS / 2], samples[ROUND_TRIPS * 99 / 100] };
+}
+
+void printThroughput(const char* name, double mops, bool checksumOk) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << mops << " M elements/s" << (checksumOk ? "" : "   CHECKSUM MISMATCH") << std::endl;
+}
+
+void printLatency(const char* name, const Latency& latency) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(10) << latency.p50 << " ns p50" << std::setw(10) << latency.p99 << " ns p99" << std::endl;
+}
+
+int main() {
+    std::cout << "ONE PRODUCER, ONE CONSUMER (" << TRANSFERS << " uint64_t, ring of " << RING_CAPACITY << ", "
+              << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+    bool checksumOk = false;
+    double mops = throughput<LockedRing>(checksumOk);
+    printThroughput("mutex + ring Deque", mops, checksumOk);
+    mops = throughput<SingleRing>(checksumOk);
+    printThroughput("SpscRing try_push/try_pop", mops, checksumOk);
+    mops = throughput<BatchRing>(checksumOk);
+    printThroughput("SpscRing try_push_n/try_pop_n (32)", mops, checksumOk);
+
+    std::cout << "\nROUND TRIP THROUGH TWO QUEUES (" << ROUND_TRIPS << " ping-pongs)\n" << std::endl;
+
+    printLatency("mutex + ring Deque", roundTrip<LockedRing>());
+    printLatency("SpscRing", roundTrip<SingleRing>());
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <string>
+#include <stdexcept>
+
+#include "SpscRing.h"
+
+// an element whose copy constructor throws for negative values; alive counts the constructed ones
+struct Fragile {
+    static inline int alive = 0;
+
+    explicit Fragile(int value) : _value(value) {
+        alive++;
+    }
+
+    Fragile(const Fragile& source) : _value(source._value) {
+        if (_value < 0) {
+            throw std::runtime_error("Fragile Error: Copy of a negative value!");
+        }
+        alive++;
+    }
+
+    Fragile(Fragile&& source) noexcept : _value(source._value) {
+        alive++;
+    }
+
+    Fragile& operator=(const Fragile& right) = default;
+    Fragile& operator=(Fragile&& right) noexcept = default;
+
+    ~Fragile() {
+        alive--;
+    }
+
+    int _value;
+};
+
+// an output iterator into a buffer of room strings that throws once the buffer is full
+struct LimitedOutput {
+    std::string* out;
+    size_t room;
+
+    LimitedOutput& operator*() {
+        return *this;
+    }
+
+    LimitedOutput& operator++() {
+        return *this;
+    }
+
+    LimitedOutput& operator=(std::string&& value) {
+        if (room == 0) {
+            throw std::length_error("LimitedOutput Error: The buffer is full!");
+        }
+        *out++ = std::move(value);
+        room--;
+        return *this;
+    }
+};
+
+int main() {
+    std::ofstream mySpscRingTestFile("SpscRingTests.txt", std::ofstream::out | std::ios::trunc);
+
+    mySpscRingTestFile << "SPSC RING\n" << std::endl;
+
+    // single-threaded use
+    {
+        SpscRing<std::string> ring(6);
+
+        mySpscRingTestFile << "SpscRing<std::string>(6), capacity() = " << ring.capacity()
+                           << ", empty() = " << std::boolalpha << ring.empty() << std::endl;
+
+        ring.try_push("first");
+        std::string second = "second";
+        ring.try_push(second);
+        ring.try_emplace(3, '*');
+        mySpscRingTestFile << "After try_push(\"first\"), try_push(\"second\"), try_emplace(3, '*'), size() = "
+                           << ring.size() << std::endl;
+
+        const std::string words[] = { "a", "b", "c", "d", "e", "f", "g" };
+        mySpscRingTestFile << "try_push_n() of 7 words pushed " << ring.try_push_n(words, 7)
+                           << ", size() = " << ring.size() << std::endl;
+        mySpscRingTestFile << "try_push() on the full ring = " << ring.try_push("h") << std::endl;
+
+        std::string value;
+        ring.try_pop(value);
+        mySpscRingTestFile << "try_pop() = " << value << std::endl;
+
+        std::string popped[4];
+        const size_t count = ring.try_pop_n(popped, 4);
+        mySpscRingTestFile << "try_pop_n(4) popped " << count << ":";
+        for (size_t i = 0; i < count; i++) {
+            mySpscRingTestFile << " " << popped[i];
+        }
+        mySpscRingTestFile << std::endl;
+
+        mySpscRingTestFile << "try_pop() until empty:";
+        while (ring.try_pop(value)) {
+            mySpscRingTestFile << " " << value;
+        }
+        mySpscRingTestFile << std::endl;
+        mySpscRingTestFile << "try_pop() on the empty ring = " << ring.try_pop(value) << std::endl;
+    }
+
+    // a batch whose copy throws half way is not pushed at all, and what it constructed is destroyed
+    {
+        SpscRing<Fragile> ring(8);
+        const Fragile batch[] = { Fragile(1), Fragile(2), Fragile(-3), Fragile(4) };
+        const int aliveBefore = Fragile::alive;
+
+        try {
+            ring.try_push_n(batch, 4);
+        } catch (const std::runtime_error& e) {
+            mySpscRingTestFile << "\ntry_push_n() of 4 Fragiles, the third copy throws: " << e.what() << std::endl;
+        }
+        mySpscRingTestFile << "size() = " << ring.size() << ", Fragiles leaked = " << Fragile::alive - aliveBefore << std::endl;
+
+        mySpscRingTestFile << "try_push_n() of the first 2 pushed " << ring.try_push_n(batch, 2);
+        Fragile value(0);
+        mySpscRingTestFile << ", popped:";
+        while (ring.try_pop(value)) {
+            mySpscRingTestFile << " " << value._value;
+        }
+        mySpscRingTestFile << std::endl;
+    }
+
+    // a pop whose output throws half way keeps the elements it did not hand over
+    {
+        SpscRing<std::string> ring(8);
+        const std::string words[] = { "one", "two", "three", "four", "five" };
+        ring.try_push_n(words, 5);
+
+        std::string buffer[2];
+        try {
+            ring.try_pop_n(LimitedOutput{ buffer, 2 }, 5);
+        } catch (const std::length_error& e) {
+            mySpscRingTestFile << "\ntry_pop_n(5) into room for 2: " << e.what() << std::endl;
+        }
+        mySpscRingTestFile << "handed over: " << buffer[0] << " " << buffer[1] << ", size() = " << ring.size();
+
+        std::string value;
+        mySpscRingTestFile << ", try_pop() until empty:";
+        while (ring.try_pop(value)) {
+            mySpscRingTestFile << " " << value;
+        }
+        mySpscRingTestFile << std::endl;
+    }
+
+    // one producer and one consumer, every element must arrive once and in order
+    {
+        const uint64_t pushesCount = 1000000;
+        SpscRing<uint64_t> ring(64);
+
+        std::thread producer([&ring] {
+            uint64_t batch[16];
+            for (uint64_t next = 1; next <= pushesCount;) {
+                size_t count = 0;
+                for (; count < 16 && next + count <= pushesCount; count++) {
+                    batch[count] = next + count;
+                }
+                size_t pushed = 0;
+                while (pushed < count) {
+                    pushed += ring.try_push_n(batch + pushed, count - pushed);
+                    if (pushed < count) {
+                        std::this_thread::yield();
+                    }
+                }
+                next += count;
+            }
+        });
+
+        uint64_t expected = 1, sum = 0;
+        bool inOrder = true;
+        uint64_t value = 0;
+        while (expected <= pushesCount) {
+            if (ring.try_pop(value)) {
+                inOrder = inOrder && value == expected;
+                sum += value;
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+
+        mySpscRingTestFile << "\nProducer pushes 1 to 1000000 in batches of 16, the consumer pops one at a time" << std::endl;
+        mySpscRingTestFile << "in order = " << inOrder << ", sum = " << sum
+                           << ", expected sum = " << pushesCount * (pushesCount + 1) / 2 << std::endl;
+        mySpscRingTestFile << "empty() = " << ring.empty() << std::endl;
+    }
+
+    mySpscRingTestFile.close();
+
+    return 0;
+}
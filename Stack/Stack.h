@@ -1,6 +1,9 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <iterator>
+#include <type_traits>
+
 #include "../Double_Ended_Queue_GNU_Version/Deque.h"
 
 // interface of container adaptor that gives FILO behaviour
@@ -10,7 +13,7 @@ class Stack {
 public:
     using value_type = typename _Cont::value_type;
     using size_type = typename _Cont::size_type;
-    using refernce = typename _Cont::reference;
+    using reference = typename _Cont::reference;
     using const_reference = typename _Cont::const_reference;
     using container_type = _Cont; 
 
@@ -52,6 +55,20 @@ public:
 
     void pop();
 
+    // bulk modifiers, forwarded to the container's bulk operations when it has them.
+    // push_range() passes on the status of a container that reports overflow (InplaceVector with
+    // OverflowPolicy::Error): false if the range did not fit, in which case a bulk append pushed nothing
+    // and a range of input iterators was pushed up to the element that did not fit
+    template<typename InputIt>
+    auto push_range(InputIt first, InputIt last);
+
+    // count must not exceed size()
+    void pop_n(size_t count);
+
+    // moves the top count elements to out, the top one first, pops them and returns the end of the output
+    template<typename OutputIt>
+    OutputIt drain_into(OutputIt out, size_t count);
+
     void swap(Stack& other);
 
 protected:
@@ -133,6 +150,60 @@ void Stack<_Type, _Cont>::pop() {
     return _cont.pop_back();
 }
 
+template<typename _Type, typename _Cont>
+template<typename InputIt>
+auto Stack<_Type, _Cont>::push_range(InputIt first, InputIt last) {
+    if constexpr (std::forward_iterator<InputIt> && requires { _cont.append(first, last); }) {
+        // one capacity check (and for Deque one round of chunk allocation) for the whole range
+        return _cont.append(first, last);
+    } else if constexpr (std::is_same_v<decltype(_cont.push_back(*first)), bool>) {
+        for (; first != last; ++first) {
+            if (!_cont.push_back(*first)) {
+                return false;
+            }
+        }
+        return true;
+    } else {
+        for (; first != last; ++first) {
+            _cont.push_back(*first);
+        }
+    }
+}
+
+template<typename _Type, typename _Cont>
+void Stack<_Type, _Cont>::pop_n(size_t count) {
+    if constexpr (requires { _cont.erase(_cont.end() - count, _cont.end()); }) {
+        _cont.erase(_cont.end() - count, _cont.end());
+    } else {
+        while (count-- > 0) {
+            _cont.pop_back();
+        }
+    }
+}
+
+template<typename _Type, typename _Cont>
+template<typename OutputIt>
+OutputIt Stack<_Type, _Cont>::drain_into(OutputIt out, size_t count) {
+    if constexpr (requires { _cont.erase(_cont.end() - count, _cont.end()); }) {
+        // walk the top count elements downwards, then drop them with a single erase
+        auto last = _cont.end();
+        const auto first = last - count;
+        while (last != first) {
+            *out = std::move(*--last);
+            ++out;
+        }
+        _cont.erase(first, _cont.end());
+    } else {
+        while (count-- > 0) {
+            *out = std::move(_cont.back());
+            ++out;
+            _cont.pop_back();
+        }
+    }
+
+    return out;
+}
+
 template<typename _Type, typename _Cont>
 void Stack<_Type, _Cont>::swap(Stack& other) {
     std::swap(_cont, other._cont);
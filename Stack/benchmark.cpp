@@ -0,0 +1,185 @@
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "Stack.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Doubly_Linked_List/List.h"
+#include "../Inplace_Vector/InplaceVector.h"
+#include "../Utility/Benchmark.h"
+
+constexpr size_t STACK_DEPTH = 1 << 14;
+constexpr size_t REPEATS = 32;
+constexpr size_t STEADY_OPERATIONS = 1 << 20;
+constexpr size_t STEADY_DEPTH = 64;
+
+// element of _Bytes bytes whose first word carries the value
+template<size_t _Bytes>
+struct Payload {
+    Payload() = default;
+
+    Payload(uint64_t value) {
+        _words[0] = value;
+    }
+
+    uint64_t key() const {
+        return _words[0];
+    }
+
+    uint64_t _words[_Bytes / sizeof(uint64_t)];
+};
+
+// push STACK_DEPTH elements onto an empty stack, then top and pop all of them; ns per element
+template<typename _Stack>
+void measureBackend(const char* name) {
+    double pushNs = 0.0;
+    double popNs = 0.0;
+    uint64_t checksum = 0;
+
+    for (size_t rep = 0; rep < REPEATS; rep++) {
+        // on the heap, since an InplaceVector backend of large elements would not fit on the thread's stack
+        const auto owner = std::make_unique<_Stack>();
+        _Stack& stack = *owner;
+
+        pushNs += measureNs(1, [&] {
+            for (uint64_t i = 0; i < STACK_DEPTH; i++) {
+                stack.push(i);
+            }
+        });
+
+        popNs += measureNs(1, [&] {
+            while (!stack.empty()) {
+                checksum += stack.top().key();
+                stack.pop();
+            }
+        });
+    }
+
+    // steady state: push, read top and pop on a stack kept at a shallow depth
+    const auto owner = std::make_unique<_Stack>();
+    _Stack& stack = *owner;
+    for (uint64_t i = 0; i < STEADY_DEPTH; i++) {
+        stack.push(i);
+    }
+    const double steadyNs = measureNs(STEADY_OPERATIONS, [&] {
+        stack.push(checksum);
+        checksum += stack.top().key();
+        stack.pop();
+    });
+    doNotOptimize(checksum);
+
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << pushNs / (REPEATS * STACK_DEPTH)
+              << std::setw(12) << popNs / (REPEATS * STACK_DEPTH)
+              << std::setw(14) << steadyNs << std::endl;
+}
+
+template<size_t _Bytes>
+void measureElementSize() {
+    using Element = Payload<_Bytes>;
+
+    std::cout << "\n" << _Bytes << "-byte elements" << std::endl;
+    std::cout << std::left << std::setw(30) << "backend" << std::right
+              << std::setw(10) << "push" << std::setw(12) << "top+pop" << std::setw(14) << "steady" << std::endl;
+
+    measureBackend<Stack<Element>>("Deque (default)");
+    measureBackend<Stack<Element, Vector<Element>>>("Vector");
+    measureBackend<Stack<Element, List<Element>>>("List");
+    measureBackend<Stack<Element, InplaceVector<Element, STACK_DEPTH, OverflowPolicy::Unchecked>>>("InplaceVector (Unchecked)");
+}
+
+constexpr size_t BULK_ELEMENTS = 1 << 22; // elements moved through the stack per measurement
+constexpr size_t BULK_BASE_DEPTH = 256;
+
+// pushes and pops runs of runLength elements on a stack kept at BULK_BASE_DEPTH, one element at a
+// time and with the bulk operations; ns per element
+template<typename _Stack>
+void measureBulk(const char* name, size_t runLength) {
+    using Element = typename _Stack::value_type;
+
+    std::vector<Element> run(runLength);
+    for (size_t i = 0; i < runLength; i++) {
+        run[i] = Element(i);
+    }
+    std::vector<Element> out(runLength);
+
+    const auto owner = std::make_unique<_Stack>();
+    _Stack& stack = *owner;
+    for (uint64_t i = 0; i < BULK_BASE_DEPTH; i++) {
+        stack.push(i);
+    }
+
+    const size_t runs = BULK_ELEMENTS / runLength;
+    uint64_t checksum = 0;
+
+    const double singleNs = measureNs(runs, [&] {
+        for (const Element& element : run) {
+            stack.push(element);
+        }
+        for (size_t i = 0; i < runLength; i++) {
+            out[i] = std::move(stack.top());
+            stack.pop();
+        }
+        checksum += out[0].key();
+    }) / runLength;
+
+    const double bulkNs = measureNs(runs, [&] {
+        stack.push_range(run.begin(), run.end());
+        stack.drain_into(out.begin(), runLength);
+        checksum += out[0].key();
+    }) / runLength;
+
+    const double singlePopNs = measureNs(runs, [&] {
+        stack.push_range(run.begin(), run.end());
+        for (size_t i = 0; i < runLength; i++) {
+            stack.pop();
+        }
+    }) / runLength;
+
+    const double bulkPopNs = measureNs(runs, [&] {
+        stack.push_range(run.begin(), run.end());
+        stack.pop_n(runLength);
+    }) / runLength;
+    doNotOptimize(checksum);
+
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << singleNs << std::setw(12) << bulkNs
+              << std::setw(14) << singlePopNs << std::setw(12) << bulkPopNs << std::endl;
+}
+
+template<size_t _Bytes>
+void measureBulkElementSize(size_t runLength) {
+    using Element = Payload<_Bytes>;
+
+    std::cout << "\n" << _Bytes << "-byte elements, runs of " << runLength << std::endl;
+    std::cout << std::left << std::setw(30) << "backend" << std::right
+              << std::setw(12) << "push+top/pop" << std::setw(12) << "range+drain"
+              << std::setw(14) << "range+pop" << std::setw(12) << "range+pop_n" << std::endl;
+
+    measureBulk<Stack<Element>>("Deque (default)", runLength);
+    measureBulk<Stack<Element, Vector<Element>>>("Vector", runLength);
+    measureBulk<Stack<Element, List<Element>>>("List (no bulk ops)", runLength);
+    measureBulk<Stack<Element, InplaceVector<Element, STACK_DEPTH, OverflowPolicy::Unchecked>>>("InplaceVector (Unchecked)", runLength);
+}
+
+int main() {
+    std::cout << "STACK BACKENDS, ns per operation (" << STACK_DEPTH << " pushes then pops, steady push/top/pop at depth "
+              << STEADY_DEPTH << ")" << std::endl;
+
+    measureElementSize<8>();
+    measureElementSize<32>();
+    measureElementSize<128>();
+    measureElementSize<512>();
+
+    std::cout << "\nBULK OPERATIONS, ns per element (runs pushed and popped on a stack of depth "
+              << BULK_BASE_DEPTH << ")" << std::endl;
+
+    for (size_t runLength : { 16, 256 }) {
+        measureBulkElementSize<8>(runLength);
+        measureBulkElementSize<128>(runLength);
+    }
+
+    return 0;
+}
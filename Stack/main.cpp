@@ -3,8 +3,13 @@
 #include <fstream>
 #include <stack>
 #include <queue>
+#include <sstream>
+#include <iterator>
 
 #include "Stack.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Doubly_Linked_List/List.h"
+#include "../Inplace_Vector/InplaceVector.h"
 
 struct Point3D {
     Point3D() : _x(0.0f), _y(0.0f), _z(0.0f) {
@@ -75,8 +80,8 @@ std::ostream& operator<<(std::ostream& out, const Point3D& point3d) {
     return out << "x=" << point3d._x << ", "  << "y=" << point3d._y << ", " << "z=" << point3d._z;
 }
 
-template<typename T>
-void writeStack(Stack<T>& stack, std::ofstream& tFile) {
+template<typename T, typename C>
+void writeStack(Stack<T, C>& stack, std::ofstream& tFile) {
     tFile << "\nStack::size() = " << stack.size() << "\n" << std::endl;
         
     tFile << "--------start-popping-stack---------" << std::endl;
@@ -297,6 +302,86 @@ int main() {
         writeStack(st2, myStackTestFile);
     }
 
+    // Stack over other backends
+    {
+        myStackTestFile << "\nSTACK BACKENDS" << std::endl;
+
+        Stack<Point3D, Vector<Point3D>> vectorStack;
+        Stack<Point3D, List<Point3D>> listStack;
+
+        for (unsigned i = 1; i <= 5; ++i) {
+            vectorStack.emplace(i);
+            listStack.push(Point3D(i * 10.0f));
+        }
+
+        myStackTestFile << "\nPop Stack over Vector with Point3D(1) to Point3D(5) elements" << std::endl;
+        writeStack(vectorStack, myStackTestFile);
+
+        myStackTestFile << "\nPop Stack over List with Point3D(10) to Point3D(50) elements" << std::endl;
+        writeStack(listStack, myStackTestFile);
+    }
+
+    // bulk push and pop
+    {
+        myStackTestFile << "\nSTACK BULK OPERATIONS" << std::endl;
+
+        const Point3D tokens[] = { Point3D(1), Point3D(2), Point3D(3), Point3D(4), Point3D(5), Point3D(6), Point3D(7), Point3D(8), Point3D(9) };
+
+        Stack<Point3D> dequeStack;
+        Stack<Point3D, Vector<Point3D>> vectorStack;
+        Stack<Point3D, List<Point3D>> listStack;
+
+        dequeStack.push_range(std::begin(tokens), std::end(tokens));
+        vectorStack.push_range(std::begin(tokens), std::end(tokens));
+        listStack.push_range(std::begin(tokens), std::end(tokens));
+
+        myStackTestFile << "\npush_range() of Point3D(1) to Point3D(9), then pop_n(2) and drain_into() of the top 3" << std::endl;
+
+        dequeStack.pop_n(2);
+        vectorStack.pop_n(2);
+        listStack.pop_n(2);
+
+        Point3D drained[3];
+        dequeStack.drain_into(drained, 3);
+        myStackTestFile << "Deque: drained";
+        for (const Point3D& point : drained) {
+            myStackTestFile << " (" << point << ")";
+        }
+        myStackTestFile << ", size() = " << dequeStack.size() << ", top() = " << dequeStack.top() << std::endl;
+
+        vectorStack.drain_into(drained, 3);
+        myStackTestFile << "Vector: drained";
+        for (const Point3D& point : drained) {
+            myStackTestFile << " (" << point << ")";
+        }
+        myStackTestFile << ", size() = " << vectorStack.size() << ", top() = " << vectorStack.top() << std::endl;
+
+        listStack.drain_into(drained, 3);
+        myStackTestFile << "List: drained";
+        for (const Point3D& point : drained) {
+            myStackTestFile << " (" << point << ")";
+        }
+        myStackTestFile << ", size() = " << listStack.size() << ", top() = " << listStack.top() << std::endl;
+    }
+
+    // push_range() onto a bounded backend that reports overflow
+    {
+        myStackTestFile << "\nSTACK OVER INPLACE VECTOR WITH OverflowPolicy::Error" << std::endl;
+
+        Stack<int, InplaceVector<int, 4, OverflowPolicy::Error>> boundedStack;
+        const int values[] = { 1, 2, 3, 4, 5, 6 };
+
+        myStackTestFile << "\npush_range() of 3 values returned " << std::boolalpha << boundedStack.push_range(values, values + 3)
+                        << ", size() = " << boundedStack.size() << std::endl;
+        myStackTestFile << "push_range() of 3 more returned " << boundedStack.push_range(values + 3, values + 6)
+                        << ", size() = " << boundedStack.size() << std::endl;
+
+        std::istringstream input("4 5 6");
+        myStackTestFile << "push_range() of 3 more through input iterators returned "
+                        << boundedStack.push_range(std::istream_iterator<int>(input), std::istream_iterator<int>())
+                        << ", size() = " << boundedStack.size() << ", top() = " << boundedStack.top() << std::endl;
+    }
+
     myStackTestFile.close();
 
     return 0;
@@ -0,0 +1,311 @@
+#ifndef STACKARENA_H
+#define STACKARENA_H
+
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace constants {
+    constexpr size_t DEFAULT_ARENA_BLOCK_SIZE = 64 * 1024;
+}
+
+// interface of a LIFO bump allocator.
+// Memory is carved out of large blocks by moving a pointer forward. deallocate() only gives memory back
+// when it is the most recent allocation, everything else is reclaimed at once by rewinding to a marker
+// or by reset(). Blocks released by a rewind are kept and reused, so a request loop that resets the
+// arena reaches a steady state without calling the global heap. Not thread-safe: use one arena per thread.
+
+class StackArena {
+private:
+    struct _Block;
+
+public:
+    // a position in the arena, everything allocated after it is released by rewind()
+    class Marker {
+    private:
+        friend class StackArena;
+
+        _Block* _block = nullptr;
+        char* _top = nullptr;
+    };
+
+    // RAII marker, rewinds the arena to where it was when the scope was opened
+    class Scope {
+    public:
+        explicit Scope(StackArena& arena);
+
+        Scope(const Scope& source) = delete;
+
+        ~Scope();
+
+        Scope& operator=(const Scope& right) = delete;
+
+    private:
+        StackArena& _arena;
+        Marker _marker;
+    };
+
+    // ctors
+    explicit StackArena(size_t blockSize = constants::DEFAULT_ARENA_BLOCK_SIZE);
+
+    StackArena(const StackArena& source) = delete;
+
+    // dtor
+    ~StackArena();
+
+    // operator=
+    StackArena& operator=(const StackArena& right) = delete;
+
+    // allocation
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    // pops the allocation if it is the most recent one, otherwise a no-op
+    void deallocate(void* ptr, size_t bytes);
+
+    Marker marker() const;
+
+    void rewind(const Marker& marker);
+
+    void reset();
+
+    // observers
+    size_t used() const;
+
+    size_t reserved() const;
+
+    size_t block_size() const;
+
+private:
+    struct _Block {
+        _Block* _prev;
+        size_t _size; // usable bytes after the header
+    };
+
+    static char* _data(_Block* block);
+
+    static char* _alignUp(char* ptr, size_t alignment);
+
+    void _pushBlock(size_t minBytes);
+
+    void _releaseBlock(_Block* block);
+
+    static void _freeBlocks(_Block* block);
+
+private:
+    const size_t _blockSize;
+    _Block* _current; // the block being bumped into, its _prev chain holds the older ones
+    _Block* _spare; // standard-size blocks released by rewind(), reused before the heap is asked again
+    char* _top;
+    char* _end;
+    size_t _usedInOlderBlocks; // bytes handed out from the blocks below _current
+};
+
+// interface of a standard allocator drawing memory from a StackArena.
+// Vector, List and the GNU Deque take it as their second template argument, the ring Deque as its third. Copies and rebinds share the arena,
+// which must outlive every container using it.
+
+template<typename _Type>
+class ArenaAllocator {
+public:
+    using value_type = _Type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    // ctors
+    ArenaAllocator(StackArena& arena) noexcept;
+
+    template<typename _Other>
+    ArenaAllocator(const ArenaAllocator<_Other>& other) noexcept;
+
+    // allocation
+    _Type* allocate(size_t count);
+
+    void deallocate(_Type* ptr, size_t count) noexcept;
+
+    // observers
+    StackArena& arena() const;
+
+private:
+    template<typename _Other>
+    friend class ArenaAllocator;
+
+    StackArena* _arena;
+};
+
+// StackArena definition
+
+inline StackArena::Scope::Scope(StackArena& arena) : _arena(arena), _marker(arena.marker()) {}
+
+inline StackArena::Scope::~Scope() {
+    _arena.rewind(_marker);
+}
+
+inline StackArena::StackArena(size_t blockSize) :
+    _blockSize(blockSize), _current(nullptr), _spare(nullptr), _top(nullptr), _end(nullptr), _usedInOlderBlocks(0) {
+    if (_blockSize == 0) {
+        throw std::invalid_argument("StackArena Error: Block size must be positive!");
+    }
+}
+
+inline StackArena::~StackArena() {
+    _freeBlocks(_current);
+    _freeBlocks(_spare);
+}
+
+inline void* StackArena::allocate(size_t bytes, size_t alignment) {
+    char* result = _alignUp(_top, alignment);
+    if (_top == nullptr || bytes > size_t(_end - result)) {
+        if (bytes > SIZE_MAX - alignment) {
+            throw std::length_error("StackArena Error: Requested size is too large!");
+        }
+        _pushBlock(bytes + alignment);
+        result = _alignUp(_top, alignment);
+    }
+
+    _top = result + bytes;
+
+    return result;
+}
+
+inline void StackArena::deallocate(void* ptr, size_t bytes) {
+    // only the top of the stack can be popped, the alignment padding before it stays used
+    if (ptr != nullptr && static_cast<char*>(ptr) + bytes == _top) {
+        _top = static_cast<char*>(ptr);
+    }
+}
+
+inline StackArena::Marker StackArena::marker() const {
+    Marker marker;
+    marker._block = _current;
+    marker._top = _top;
+
+    return marker;
+}
+
+inline void StackArena::rewind(const Marker& marker) {
+    while (_current != marker._block) {
+        _Block* released = _current;
+        _current = released->_prev;
+        _releaseBlock(released);
+        if (_current != nullptr) {
+            _usedInOlderBlocks -= _current->_size;
+        }
+    }
+
+    _top = marker._top;
+    _end = _current != nullptr ? _data(_current) + _current->_size : nullptr;
+    if (_current == nullptr) {
+        _usedInOlderBlocks = 0;
+    }
+}
+
+inline void StackArena::reset() {
+    rewind(Marker());
+}
+
+inline size_t StackArena::used() const {
+    return _current != nullptr ? _usedInOlderBlocks + size_t(_top - _data(_current)) : 0;
+}
+
+inline size_t StackArena::reserved() const {
+    size_t bytes = 0;
+    for (const _Block* block = _current; block != nullptr; block = block->_prev) {
+        bytes += block->_size;
+    }
+    for (const _Block* block = _spare; block != nullptr; block = block->_prev) {
+        bytes += block->_size;
+    }
+
+    return bytes;
+}
+
+inline size_t StackArena::block_size() const {
+    return _blockSize;
+}
+
+inline char* StackArena::_data(_Block* block) {
+    return reinterpret_cast<char*>(block + 1);
+}
+
+inline char* StackArena::_alignUp(char* ptr, size_t alignment) {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    return ptr + ((alignment - address % alignment) % alignment);
+}
+
+inline void StackArena::_pushBlock(size_t minBytes) {
+    _Block* block = nullptr;
+    if (minBytes <= _blockSize && _spare != nullptr) {
+        block = _spare;
+        _spare = block->_prev;
+    } else {
+        // an allocation larger than the block size gets a block of its own
+        const size_t size = minBytes > _blockSize ? minBytes : _blockSize;
+        block = static_cast<_Block*>(::operator new(sizeof(_Block) + size));
+        block->_size = size;
+    }
+
+    if (_current != nullptr) {
+        // the tail of the abandoned block counts as used until the block is released
+        _usedInOlderBlocks += _current->_size;
+    }
+    block->_prev = _current;
+    _current = block;
+    _top = _data(block);
+    _end = _top + block->_size;
+}
+
+inline void StackArena::_releaseBlock(_Block* block) {
+    if (block->_size == _blockSize) {
+        block->_prev = _spare;
+        _spare = block;
+    } else {
+        ::operator delete(block);
+    }
+}
+
+inline void StackArena::_freeBlocks(_Block* block) {
+    while (block != nullptr) {
+        _Block* prev = block->_prev;
+        ::operator delete(block);
+        block = prev;
+    }
+}
+
+// ArenaAllocator definition
+
+template<typename _Type>
+ArenaAllocator<_Type>::ArenaAllocator(StackArena& arena) noexcept : _arena(&arena) {}
+
+template<typename _Type>
+template<typename _Other>
+ArenaAllocator<_Type>::ArenaAllocator(const ArenaAllocator<_Other>& other) noexcept : _arena(other._arena) {}
+
+template<typename _Type>
+_Type* ArenaAllocator<_Type>::allocate(size_t count) {
+    if (count > SIZE_MAX / sizeof(_Type)) {
+        throw std::length_error("ArenaAllocator Error: Requested size is too large!");
+    }
+
+    return static_cast<_Type*>(_arena->allocate(count * sizeof(_Type), alignof(_Type)));
+}
+
+template<typename _Type>
+void ArenaAllocator<_Type>::deallocate(_Type* ptr, size_t count) noexcept {
+    _arena->deallocate(ptr, count * sizeof(_Type));
+}
+
+template<typename _Type>
+StackArena& ArenaAllocator<_Type>::arena() const {
+    return *_arena;
+}
+
+template<typename _Type, typename _Other>
+bool operator==(const ArenaAllocator<_Type>& left, const ArenaAllocator<_Other>& right) {
+    return &left.arena() == &right.arena();
+}
+
+#endif // !STACKARENA_H
@@ -0,0 +1,95 @@
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <cstdint>
+
+#include "StackArena.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Doubly_Linked_List/List.h"
+#include "../Double_Ended_Queue_GNU_Version/Deque.h"
+#include "../Utility/Benchmark.h"
+
+constexpr size_t REQUESTS = 1 << 16;
+
+struct Header {
+    uint32_t key;
+    uint32_t value;
+};
+
+// the shape of a request: tokenize into a Vector, collect headers in a List, run events through a Deque.
+// Every container is a temporary that dies when the request is done
+template<template<typename> class _Alloc, typename... _Args>
+uint64_t handleRequest(uint64_t seed, size_t tokensCount, _Args&... allocArgs) {
+    Vector<uint32_t, _Alloc<uint32_t>> tokens{ _Alloc<uint32_t>(allocArgs...) };
+    List<Header, _Alloc<Header>> headers{ _Alloc<Header>(allocArgs...) };
+    Deque<uint64_t, _Alloc<uint64_t>> events{ _Alloc<uint64_t>(allocArgs...) };
+
+    for (size_t i = 0; i < tokensCount; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        tokens.push_back(uint32_t(seed));
+        if (seed % 8 == 0) {
+            headers.push_back(Header{ uint32_t(i), uint32_t(seed >> 32) });
+        }
+        events.push_back(seed);
+        if (events.size() > 32) {
+            events.pop_front();
+        }
+    }
+
+    uint64_t checksum = tokens.size();
+    for (const Header& header : headers) {
+        checksum += header.key ^ header.value;
+    }
+    while (!events.empty()) {
+        checksum += events.front();
+        events.pop_front();
+    }
+
+    return checksum;
+}
+
+template<typename _Type>
+using HeapAllocator = std::allocator<_Type>;
+
+void printRow(const char* name, size_t tokensCount, double ns, double heapNs) {
+    std::cout << std::left << std::setw(34) << name << std::right << std::setw(6) << tokensCount << " tokens"
+              << std::setw(12) << std::fixed << std::setprecision(1) << ns << " ns/request"
+              << std::setw(8) << std::setprecision(2) << heapNs / ns << "x" << std::endl;
+}
+
+int main() {
+    std::cout << "REQUEST-SHAPED WORKLOAD (" << REQUESTS << " requests, each builds and drops a Vector, a List and a Deque)\n"
+              << std::endl;
+
+    for (size_t tokensCount : { 16, 64, 256, 1024, 4096 }) {
+        const size_t requests = REQUESTS * 16 / tokensCount;
+        uint64_t checksum = 0;
+
+        const double heapNs = measureNs(requests, [&] {
+            checksum += handleRequest<HeapAllocator>(checksum + 1, tokensCount);
+        });
+        doNotOptimize(checksum);
+        printRow("global heap (std::allocator)", tokensCount, heapNs, heapNs);
+
+        StackArena arena;
+        const double resetNs = measureNs(requests, [&] {
+            checksum += handleRequest<ArenaAllocator>(checksum + 1, tokensCount, arena);
+            arena.reset();
+        });
+        doNotOptimize(checksum);
+        printRow("StackArena, reset() per request", tokensCount, resetNs, heapNs);
+
+        const double scopeNs = measureNs(requests, [&] {
+            StackArena::Scope scope(arena);
+            checksum += handleRequest<ArenaAllocator>(checksum + 1, tokensCount, arena);
+        });
+        doNotOptimize(checksum);
+        printRow("StackArena, Scope per request", tokensCount, scopeNs, heapNs);
+
+        std::cout << std::setw(34) << "" << "  arena reserved() = " << arena.reserved() << " bytes\n" << std::endl;
+    }
+
+    return 0;
+}
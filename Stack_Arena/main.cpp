@@ -0,0 +1,127 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include "StackArena.h"
+#include "../Dynamic_Array/Vector.h"
+#include "../Doubly_Linked_List/List.h"
+#include "../Double_Ended_Queue_GNU_Version/Deque.h"
+
+template<typename _Type>
+using ArenaVector = Vector<_Type, ArenaAllocator<_Type>>;
+
+template<typename _Type>
+using ArenaList = List<_Type, ArenaAllocator<_Type>>;
+
+template<typename _Type>
+using ArenaDeque = Deque<_Type, ArenaAllocator<_Type>>;
+
+int main() {
+    std::ofstream myStackArenaTestFile("StackArenaTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myStackArenaTestFile << "STACK ARENA\n" << std::endl;
+
+    StackArena arena(4096);
+    myStackArenaTestFile << "StackArena(4096), block_size() = " << arena.block_size() << ", used() = " << arena.used()
+                         << ", reserved() = " << arena.reserved() << std::endl;
+
+    // raw allocations: bumping, alignment and popping the most recent one
+    {
+        char* first = static_cast<char*>(arena.allocate(10, 1));
+        double* second = static_cast<double*>(arena.allocate(sizeof(double), alignof(double)));
+        myStackArenaTestFile << "\nallocate(10, 1) then allocate(8, 8), used() = " << arena.used()
+                             << ", second is 8-byte aligned = " << std::boolalpha
+                             << (reinterpret_cast<uintptr_t>(second) % alignof(double) == 0) << std::endl;
+
+        arena.deallocate(first, 10);
+        myStackArenaTestFile << "deallocate() of the first block, not on top, used() = " << arena.used() << std::endl;
+
+        arena.deallocate(second, sizeof(double));
+        myStackArenaTestFile << "deallocate() of the second block, on top, used() = " << arena.used() << std::endl;
+
+        arena.allocate(3 * 4096);
+        myStackArenaTestFile << "allocate(12288), larger than a block, reserved() = " << arena.reserved() << std::endl;
+
+        arena.reset();
+        myStackArenaTestFile << "reset(), used() = " << arena.used() << ", reserved() = " << arena.reserved() << std::endl;
+    }
+
+    // containers drawing from the arena
+    {
+        ArenaVector<int> vector(arena);
+        for (int i = 1; i <= 100; i++) {
+            vector.push_back(i * i);
+        }
+
+        ArenaList<std::string> list(arena);
+        list.push_back("second");
+        list.push_front("first");
+        list.push_back("third");
+
+        ArenaDeque<int> deque(arena);
+        for (int i = 0; i < 50; i++) {
+            deque.push_back(i);
+            deque.push_front(-i);
+        }
+
+        myStackArenaTestFile << "\nVector of 100 squares, back() = " << vector.back() << std::endl;
+        myStackArenaTestFile << "List:";
+        for (const std::string& word : list) {
+            myStackArenaTestFile << " " << word;
+        }
+        myStackArenaTestFile << std::endl;
+        myStackArenaTestFile << "Deque of 100 elements, front() = " << deque.front() << ", back() = " << deque.back() << std::endl;
+        myStackArenaTestFile << "get_allocator() of the three containers uses the arena = "
+                             << (&vector.get_allocator().arena() == &arena && &list.get_allocator().arena() == &arena
+                                 && &deque.get_allocator().arena() == &arena) << std::endl;
+        myStackArenaTestFile << "used() > 0 = " << (arena.used() > 0) << std::endl;
+
+        ArenaVector<int> copy(vector);
+        myStackArenaTestFile << "copy of the Vector shares the arena = " << (copy.get_allocator() == vector.get_allocator())
+                             << ", copy[9] = " << copy[9] << std::endl;
+    }
+    arena.reset();
+    myStackArenaTestFile << "After the containers are gone and reset(), used() = " << arena.used() << std::endl;
+
+    // the sized and initializer_list constructors take the allocator too, ArenaAllocator has no default
+    {
+        ArenaVector<int> zeros(4, arena);
+        ArenaVector<int> sevens(3, 7, arena);
+        ArenaVector<int> listed({ 1, 2, 3, 4, 5 }, arena);
+        myStackArenaTestFile << "\nVector(4, arena).size() = " << zeros.size() << ", Vector(3, 7, arena).back() = " << sevens.back()
+                             << ", Vector({ 1, 2, 3, 4, 5 }, arena).back() = " << listed.back() << std::endl;
+
+        // copy assignment propagates ArenaAllocator, so the copy moves over to the other arena
+        StackArena other;
+        ArenaVector<int> target(arena);
+        ArenaVector<int> source({ 10, 20 }, other);
+        target = source;
+        myStackArenaTestFile << "Vector copy assigned from one on another arena uses that arena = "
+                             << (&target.get_allocator().arena() == &other) << ", target[1] = " << target[1] << std::endl;
+    }
+    arena.reset();
+
+    // scoped markers release everything allocated inside the scope
+    {
+        ArenaVector<int> outer(arena);
+        outer.push_back(1);
+        const size_t usedBefore = arena.used();
+
+        {
+            StackArena::Scope scope(arena);
+            ArenaList<int> scratch(arena);
+            for (int i = 0; i < 1000; i++) {
+                scratch.push_back(i);
+            }
+            myStackArenaTestFile << "\nInside a Scope, a List of 1000 elements grows used() by more than 0 = "
+                                 << (arena.used() > usedBefore) << std::endl;
+        }
+
+        myStackArenaTestFile << "After the Scope, used() is back where it was = " << (arena.used() == usedBefore)
+                             << ", outer[0] = " << outer[0] << std::endl;
+    }
+
+    myStackArenaTestFile.close();
+
+    return 0;
+}
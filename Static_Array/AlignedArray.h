@@ -0,0 +1,281 @@
+#ifndef ALIGNEDARRAY_H
+#define ALIGNEDARRAY_H
+
+#include <iterator>
+#include <type_traits>
+
+#include "Array.h"
+#include "../Utility/CacheLine.h"
+
+// every element padded to its own _Align-byte slot
+template<typename _Type, size_t _Align>
+struct alignas(_Align) _AlignedSlot {
+    _Type _value;
+};
+
+template<typename _Type, size_t _Align, bool _IsConst>
+class _AlignedArrayIterator;
+
+// interface of fixed-size Array whose elements are each aligned to, and padded up to, _Align bytes.
+// With the default cache-line alignment no two elements share a cache line, so slots written by different
+// cores never cause false sharing. The elements are no longer contiguous, hence there is no data().
+
+template<typename _Type, std::size_t _Size, std::size_t _Align = constants::CACHE_LINE_SIZE>
+class AlignedArray {
+public:
+    static_assert(_Align >= alignof(_Type) && (_Align & (_Align - 1)) == 0,
+        "AlignedArray Error: Alignment must be a power of two not smaller than alignof(_Type)!");
+
+    using value_type = _Type;
+    using iterator = _AlignedArrayIterator<_Type, _Align, false>;
+    using const_iterator = _AlignedArrayIterator<_Type, _Align, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // element access
+    constexpr _Type& at(size_t idx);
+    constexpr const _Type& at(size_t idx) const;
+
+    constexpr _Type& operator[](size_t idx);
+    constexpr const _Type& operator[](size_t idx) const;
+
+    constexpr _Type& front();
+    constexpr const _Type& front() const;
+
+    constexpr _Type& back();
+    constexpr const _Type& back() const;
+
+    // iterators
+    constexpr iterator begin();
+    constexpr const_iterator cbegin() const;
+
+    constexpr iterator end();
+    constexpr const_iterator cend() const;
+
+    constexpr reverse_iterator rbegin();
+    constexpr const_reverse_iterator crbegin() const;
+
+    constexpr reverse_iterator rend();
+    constexpr const_reverse_iterator crend() const;
+
+    // capacity
+    constexpr bool empty() const;
+
+    constexpr size_t size() const;
+
+    // operations
+    constexpr void fill(const _Type& value);
+
+    constexpr void swap(AlignedArray& other);
+
+private:
+    Array<_AlignedSlot<_Type, _Align>, _Size> _slots;
+};
+
+// AlignedArray definition
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr _Type& AlignedArray<_Type, _Size, _Align>::at(size_t idx) {
+    if (idx >= size()) {
+        throw std::out_of_range("AlignedArray Error: Index out of bounds!");
+    }
+
+    return _slots[idx]._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr const _Type& AlignedArray<_Type, _Size, _Align>::at(size_t idx) const {
+    if (idx >= size()) {
+        throw std::out_of_range("AlignedArray Error: Index out of bounds!");
+    }
+
+    return _slots[idx]._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr _Type& AlignedArray<_Type, _Size, _Align>::operator[](size_t idx) {
+    return _slots[idx]._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr const _Type& AlignedArray<_Type, _Size, _Align>::operator[](size_t idx) const {
+    return _slots[idx]._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr _Type& AlignedArray<_Type, _Size, _Align>::front() {
+    return _slots.front()._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr const _Type& AlignedArray<_Type, _Size, _Align>::front() const {
+    return _slots.front()._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr _Type& AlignedArray<_Type, _Size, _Align>::back() {
+    return _slots.back()._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr const _Type& AlignedArray<_Type, _Size, _Align>::back() const {
+    return _slots.back()._value;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::iterator AlignedArray<_Type, _Size, _Align>::begin() {
+    return iterator(_slots.begin());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::const_iterator AlignedArray<_Type, _Size, _Align>::cbegin() const {
+    return const_iterator(_slots.cbegin());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::iterator AlignedArray<_Type, _Size, _Align>::end() {
+    return iterator(_slots.end());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::const_iterator AlignedArray<_Type, _Size, _Align>::cend() const {
+    return const_iterator(_slots.cend());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::reverse_iterator AlignedArray<_Type, _Size, _Align>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::const_reverse_iterator AlignedArray<_Type, _Size, _Align>::crbegin() const {
+    return const_reverse_iterator(cend());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::reverse_iterator AlignedArray<_Type, _Size, _Align>::rend() {
+    return reverse_iterator(begin());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr typename AlignedArray<_Type, _Size, _Align>::const_reverse_iterator AlignedArray<_Type, _Size, _Align>::crend() const {
+    return const_reverse_iterator(cbegin());
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr bool AlignedArray<_Type, _Size, _Align>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr size_t AlignedArray<_Type, _Size, _Align>::size() const {
+    return _Size;
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr void AlignedArray<_Type, _Size, _Align>::fill(const _Type& value) {
+    std::fill_n(begin(), size(), value);
+}
+
+template<typename _Type, std::size_t _Size, std::size_t _Align>
+constexpr void AlignedArray<_Type, _Size, _Align>::swap(AlignedArray& other) {
+    std::swap_ranges(begin(), end(), other.begin());
+}
+
+// definition of random access iterator striding over the padded slots
+
+template<typename _Type, size_t _Align, bool _IsConst>
+class _AlignedArrayIterator {
+private:
+    using _SlotPtr = std::conditional_t<_IsConst, const _AlignedSlot<_Type, _Align>*, _AlignedSlot<_Type, _Align>*>;
+
+public:
+    using _Self = _AlignedArrayIterator<_Type, _Align, _IsConst>;
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = _Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<_IsConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<_IsConst, const value_type&, value_type&>;
+
+    // ctors
+    constexpr _AlignedArrayIterator() : _slot(nullptr) {}
+
+    constexpr explicit _AlignedArrayIterator(_SlotPtr slot) : _slot(slot) {}
+
+    // operator overloads
+    constexpr bool operator==(const _Self& right) const {
+        return _slot == right._slot;
+    }
+
+    constexpr auto operator<=>(const _Self& right) const {
+        return _slot <=> right._slot;
+    }
+
+    constexpr reference operator*() const {
+        return _slot->_value;
+    }
+
+    constexpr pointer operator->() const {
+        return std::addressof(_slot->_value);
+    }
+
+    constexpr reference operator[](difference_type off) const {
+        return _slot[off]._value;
+    }
+
+    // iterator increment and decrement
+    constexpr _Self& operator++() { // prefix
+        ++_slot;
+        return *this;
+    }
+
+    constexpr _Self operator++(int) { // postfix
+        _Self tmp = *this;
+        ++_slot;
+        return tmp;
+    }
+
+    constexpr _Self& operator--() { // prefix
+        --_slot;
+        return *this;
+    }
+
+    constexpr _Self operator--(int) { // postfix
+        _Self tmp = *this;
+        --_slot;
+        return tmp;
+    }
+
+    // pointer arithmetic
+    constexpr _Self& operator+=(difference_type off) {
+        _slot += off;
+        return *this;
+    }
+
+    constexpr _Self operator+(difference_type off) const {
+        return _Self(_slot + off);
+    }
+
+    friend constexpr _Self operator+(difference_type off, const _Self& it) {
+        return it + off;
+    }
+
+    constexpr _Self& operator-=(difference_type off) {
+        _slot -= off;
+        return *this;
+    }
+
+    constexpr _Self operator-(difference_type off) const {
+        return _Self(_slot - off);
+    }
+
+    constexpr difference_type operator-(const _Self& right) const {
+        return _slot - right._slot;
+    }
+
+private:
+    _SlotPtr _slot; // the padded slot the iterator points to
+};
+
+#endif // !ALIGNEDARRAY_H
@@ -2,18 +2,45 @@
 #define STATICARRAY_H
 
 #include <exception>
+#include <stdexcept>
 #include <algorithm>
+#include <utility>
+
+#include "SortingNetwork.h"
+#include "../Utility/Compare.h"
+#include "../Utility/Hash.h"
+
+namespace constants {
+    // element-wise loops over Arrays up to this size are expanded at compile time
+    constexpr size_t ARRAY_UNROLL_LIMIT = 64;
+}
+
+// lazily evaluated element-wise expression over Arrays (the nodes are defined in ArrayMath.h)
+template<typename _Expr>
+concept _ArrayExpression = requires { typename _Expr::_IsArrayExpression; };
 
 // interface of fixed-size stack-allocated Array (std::array)
 
 template<typename _Type, std::size_t _Size>
 class Array {
 public:
+    using value_type = _Type;
     using iterator = _Type*;
     using const_iterator = const _Type*;
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
+    // ctors
+    constexpr Array() = default;
+
+    // evaluates the whole expression in a single pass, without temporaries
+    template<_ArrayExpression _Expr>
+    constexpr Array(const _Expr& expr);
+
+    // operator=
+    template<_ArrayExpression _Expr>
+    constexpr Array& operator=(const _Expr& expr);
+
     // element access
     constexpr _Type& at(size_t idx);
     constexpr const _Type& at(size_t idx) const;
@@ -53,12 +80,61 @@ public:
 
     constexpr void swap(Array& other);
 
+    constexpr void sort();
+
+    template<typename Compare>
+    constexpr void sort(Compare comp);
+
+    size_t hash() const;
+
+private:
+    template<typename _Expr, size_t... _Idx>
+    constexpr void _assignUnrolled(const _Expr& expr, std::index_sequence<_Idx...>);
+
+    template<typename _Expr>
+    constexpr void _assign(const _Expr& expr);
+
 private:
     _Type _data[_Size];
 };
 
 // Array definition
 
+template<typename _Type, std::size_t _Size>
+template<typename _Expr, size_t... _Idx>
+constexpr void Array<_Type, _Size>::_assignUnrolled(const _Expr& expr, std::index_sequence<_Idx...>) {
+    // all loads happen before the first store, so the compiler need not assume the expression aliases _data
+    const _Type values[] = { static_cast<_Type>(expr[_Idx])... };
+    ((_data[_Idx] = values[_Idx]), ...);
+}
+
+template<typename _Type, std::size_t _Size>
+template<typename _Expr>
+constexpr void Array<_Type, _Size>::_assign(const _Expr& expr) {
+    static_assert(_Expr::size == _Size, "Array Error: Expression size mismatch!");
+
+    if constexpr (_Size <= constants::ARRAY_UNROLL_LIMIT) {
+        _assignUnrolled(expr, std::make_index_sequence<_Size>{});
+    } else {
+        for (size_t i = 0; i < _Size; i++) {
+            _data[i] = expr[i];
+        }
+    }
+}
+
+template<typename _Type, std::size_t _Size>
+template<_ArrayExpression _Expr>
+constexpr Array<_Type, _Size>::Array(const _Expr& expr) {
+    _assign(expr);
+}
+
+template<typename _Type, std::size_t _Size>
+template<_ArrayExpression _Expr>
+constexpr Array<_Type, _Size>& Array<_Type, _Size>::operator=(const _Expr& expr) {
+    _assign(expr);
+    return *this;
+}
+
 template<typename _Type, std::size_t _Size>
 constexpr _Type& Array<_Type, _Size>::at(size_t idx) {
     if (idx >= size()) {
@@ -179,4 +255,44 @@ constexpr void Array<_Type, _Size>::swap(Array& other) {
     std::swap_ranges(begin(), end(), other.begin());
 }
 
+template<typename _Type, std::size_t _Size>
+constexpr void Array<_Type, _Size>::sort() {
+    sort(std::less<>());
+}
+
+template<typename _Type, std::size_t _Size>
+template<typename Compare>
+constexpr void Array<_Type, _Size>::sort(Compare comp) {
+    // small sizes expand into a sorting network at compile time, larger ones fall back to introsort
+    if constexpr (_Size <= constants::ARRAY_NETWORK_SORT_LIMIT) {
+        _networkSort<_Size>(_data, comp);
+    } else {
+        std::sort(begin(), end(), comp);
+    }
+}
+
+template<typename _Type, std::size_t _Size>
+size_t Array<_Type, _Size>::hash() const {
+    return hashing::hashRange(data(), size());
+}
+
+// non-member comparison operators (operator!= and the relational operators are synthesized from these)
+
+template<typename _Type, std::size_t _Size>
+constexpr bool operator==(const Array<_Type, _Size>& left, const Array<_Type, _Size>& right) {
+    return comparison::rangesEqual(left.data(), left.size(), right.data(), right.size());
+}
+
+template<typename _Type, std::size_t _Size>
+constexpr auto operator<=>(const Array<_Type, _Size>& left, const Array<_Type, _Size>& right) {
+    return comparison::rangesCompare(left.data(), left.size(), right.data(), right.size());
+}
+
+template<typename _Type, std::size_t _Size>
+struct std::hash<Array<_Type, _Size>> {
+    size_t operator()(const Array<_Type, _Size>& arr) const {
+        return arr.hash();
+    }
+};
+
 #endif // !STATICARRAY_H
@@ -0,0 +1,345 @@
+#ifndef ARRAYMATH_H
+#define ARRAYMATH_H
+
+#include <cmath>
+#include <tuple>
+#include <limits>
+#include <type_traits>
+
+#include "Array.h"
+
+// element-wise arithmetic over arithmetic Arrays built on expression templates
+//
+// An arithmetic expression such as a * b + c only records its operands. The work happens when the
+// expression is assigned to an Array, in one pass over the elements and without temporaries.
+// Since the size is known at compile time, Arrays up to constants::ARRAY_UNROLL_LIMIT elements are
+// evaluated through fully unrolled code, which leaves the vectorization to the compiler's SLP pass.
+// Array operands are held by reference, so an expression must not outlive the Arrays it refers to.
+
+template<typename _Operand>
+struct _ArrayOperandTraits {
+    static constexpr bool isOperand = false;
+};
+
+template<typename _Type, size_t _Size>
+struct _ArrayOperandTraits<Array<_Type, _Size>> {
+    static constexpr bool isOperand = true;
+    static constexpr size_t size = _Size;
+    using value_type = _Type;
+    using storage_type = const Array<_Type, _Size>&;
+};
+
+template<_ArrayExpression _Expr>
+struct _ArrayOperandTraits<_Expr> {
+    static constexpr bool isOperand = true;
+    static constexpr size_t size = _Expr::size;
+    using value_type = typename _Expr::value_type;
+    using storage_type = _Expr;
+};
+
+template<typename _Operand>
+concept _ArrayOperand = _ArrayOperandTraits<std::remove_cvref_t<_Operand>>::isOperand &&
+    std::is_arithmetic_v<typename _ArrayOperandTraits<std::remove_cvref_t<_Operand>>::value_type>;
+
+// a scalar operand broadcast to every element
+template<typename _Type>
+struct _ArrayScalar {
+    constexpr _Type operator[](size_t) const {
+        return _value;
+    }
+
+    _Type _value;
+};
+
+// operand storage: Arrays by reference, expression nodes and scalars by value
+template<typename _Operand, typename _Type>
+struct _ArrayStorage {
+    using type = _ArrayScalar<_Type>;
+};
+
+template<_ArrayOperand _Operand, typename _Type>
+struct _ArrayStorage<_Operand, _Type> {
+    using type = typename _ArrayOperandTraits<_Operand>::storage_type;
+};
+
+template<typename _Operand, typename _Type>
+using _ArrayStorageType = typename _ArrayStorage<std::remove_cvref_t<_Operand>, _Type>::type;
+
+// the value type and size of an expression, taken from whichever operands are Arrays or expressions
+
+template<typename... _Operands>
+struct _ArrayExprTraits;
+
+template<typename _First, typename... _Rest>
+struct _ArrayExprTraits<_First, _Rest...> {
+    using value_type = typename _ArrayExprTraits<_Rest...>::value_type;
+    static constexpr size_t size = _ArrayExprTraits<_Rest...>::size;
+};
+
+template<_ArrayOperand _First, typename... _Rest>
+struct _ArrayExprTraits<_First, _Rest...> {
+    using value_type = typename _ArrayOperandTraits<std::remove_cvref_t<_First>>::value_type;
+    static constexpr size_t size = _ArrayOperandTraits<std::remove_cvref_t<_First>>::size;
+};
+
+template<typename _Operand, typename _Type, size_t _Size>
+constexpr bool _isCompatibleArrayOperand() {
+    using _Traits = _ArrayOperandTraits<std::remove_cvref_t<_Operand>>;
+
+    if constexpr (_Traits::isOperand) {
+        return _Traits::size == _Size && std::is_same_v<typename _Traits::value_type, _Type>;
+    } else {
+        return std::is_arithmetic_v<std::remove_cvref_t<_Operand>> && std::is_convertible_v<_Operand, _Type>;
+    }
+}
+
+// at least one operand is an Array or expression, every other one is either of the same size and
+// value type, or an arithmetic scalar convertible to that value type
+template<typename... _Operands>
+concept _ArrayOperands = (_ArrayOperand<_Operands> || ...) &&
+    (_isCompatibleArrayOperand<_Operands, typename _ArrayExprTraits<_Operands...>::value_type,
+        _ArrayExprTraits<_Operands...>::size>() && ...);
+
+// element-wise operations
+
+struct _ArrayPlus {
+    template<typename _Type>
+    static constexpr _Type apply(_Type left, _Type right) {
+        return left + right;
+    }
+};
+
+struct _ArrayMinus {
+    template<typename _Type>
+    static constexpr _Type apply(_Type left, _Type right) {
+        return left - right;
+    }
+};
+
+struct _ArrayMultiplies {
+    template<typename _Type>
+    static constexpr _Type apply(_Type left, _Type right) {
+        return left * right;
+    }
+};
+
+struct _ArrayDivides {
+    template<typename _Type>
+    static constexpr _Type apply(_Type left, _Type right) {
+        return left / right;
+    }
+};
+
+struct _ArrayNegate {
+    template<typename _Type>
+    static constexpr _Type apply(_Type value) {
+        return -value;
+    }
+};
+
+struct _ArrayFma {
+    template<typename _Type>
+    static constexpr _Type apply(_Type mul1, _Type mul2, _Type add) {
+#ifdef __FMA__
+        // std::fma is only worth calling where it maps to an instruction instead of a libm routine
+        if constexpr (std::is_floating_point_v<_Type>) {
+            if (!std::is_constant_evaluated()) {
+                return std::fma(mul1, mul2, add);
+            }
+        }
+#endif
+        return mul1 * mul2 + add;
+    }
+};
+
+// expression node applying _Op to the elements of its operands at the same index
+
+template<typename _Op, typename... _Operands>
+class _ArrayExpr {
+public:
+    using _IsArrayExpression = void;
+    using value_type = typename _ArrayExprTraits<_Operands...>::value_type;
+
+    static constexpr size_t size = _ArrayExprTraits<_Operands...>::size;
+
+    constexpr _ArrayExpr(const _Operands&... operands) : _operands(_makeStorage(operands)...) {}
+
+    constexpr value_type operator[](size_t idx) const {
+        return std::apply([idx](const auto&... operands) {
+            return _Op::apply(static_cast<value_type>(operands[idx])...);
+        }, _operands);
+    }
+
+private:
+    template<typename _Operand>
+    static constexpr _ArrayStorageType<_Operand, value_type> _makeStorage(const _Operand& operand) {
+        if constexpr (_ArrayOperand<_Operand>) {
+            return operand;
+        } else {
+            return _ArrayScalar<value_type>{ static_cast<value_type>(operand) };
+        }
+    }
+
+private:
+    std::tuple<_ArrayStorageType<_Operands, value_type>...> _operands;
+};
+
+// arithmetic operators
+
+template<typename _Left, typename _Right>
+requires _ArrayOperands<_Left, _Right>
+constexpr auto operator+(const _Left& left, const _Right& right) {
+    return _ArrayExpr<_ArrayPlus, _Left, _Right>(left, right);
+}
+
+template<typename _Left, typename _Right>
+requires _ArrayOperands<_Left, _Right>
+constexpr auto operator-(const _Left& left, const _Right& right) {
+    return _ArrayExpr<_ArrayMinus, _Left, _Right>(left, right);
+}
+
+template<typename _Left, typename _Right>
+requires _ArrayOperands<_Left, _Right>
+constexpr auto operator*(const _Left& left, const _Right& right) {
+    return _ArrayExpr<_ArrayMultiplies, _Left, _Right>(left, right);
+}
+
+template<typename _Left, typename _Right>
+requires _ArrayOperands<_Left, _Right>
+constexpr auto operator/(const _Left& left, const _Right& right) {
+    return _ArrayExpr<_ArrayDivides, _Left, _Right>(left, right);
+}
+
+template<_ArrayOperand _Operand>
+constexpr auto operator-(const _Operand& operand) {
+    return _ArrayExpr<_ArrayNegate, _Operand>(operand);
+}
+
+// compound assignment evaluates directly into the left-hand Array
+
+template<typename _Type, size_t _Size, typename _Right>
+requires _ArrayOperands<Array<_Type, _Size>, _Right>
+constexpr Array<_Type, _Size>& operator+=(Array<_Type, _Size>& left, const _Right& right) {
+    return left = left + right;
+}
+
+template<typename _Type, size_t _Size, typename _Right>
+requires _ArrayOperands<Array<_Type, _Size>, _Right>
+constexpr Array<_Type, _Size>& operator-=(Array<_Type, _Size>& left, const _Right& right) {
+    return left = left - right;
+}
+
+template<typename _Type, size_t _Size, typename _Right>
+requires _ArrayOperands<Array<_Type, _Size>, _Right>
+constexpr Array<_Type, _Size>& operator*=(Array<_Type, _Size>& left, const _Right& right) {
+    return left = left * right;
+}
+
+template<typename _Type, size_t _Size, typename _Right>
+requires _ArrayOperands<Array<_Type, _Size>, _Right>
+constexpr Array<_Type, _Size>& operator/=(Array<_Type, _Size>& left, const _Right& right) {
+    return left = left / right;
+}
+
+// fused multiply-add: mul1 * mul2 + add per element, rounded once where the target has FMA instructions
+
+template<typename _Mul1, typename _Mul2, typename _Add>
+requires _ArrayOperands<_Mul1, _Mul2, _Add>
+constexpr auto fma(const _Mul1& mul1, const _Mul2& mul2, const _Add& add) {
+    return _ArrayExpr<_ArrayFma, _Mul1, _Mul2, _Add>(mul1, mul2, add);
+}
+
+// reductions
+
+// folds the upper half of values onto the lower half until one element is left; every step is a
+// set of independent additions the compiler can vectorize without reassociating floating-point math
+template<size_t _Count, typename _Type>
+constexpr _Type _foldHalves(_Type* values) {
+    if constexpr (_Count == 1) {
+        return values[0];
+    } else {
+        constexpr size_t upper = (_Count + 1) / 2;
+        for (size_t i = 0; i < _Count / 2; i++) {
+            values[i] += values[upper + i];
+        }
+
+        return _foldHalves<upper>(values);
+    }
+}
+
+template<typename _Type, typename _Expr, size_t... _Idx>
+constexpr _Type _unrolledSum(const _Expr& expr, std::index_sequence<_Idx...>) {
+    _Type values[] = { expr[_Idx]... };
+    return _foldHalves<sizeof...(_Idx)>(values);
+}
+
+template<_ArrayOperand _Operand>
+constexpr auto sum(const _Operand& operand) {
+    using _Traits = _ArrayOperandTraits<std::remove_cvref_t<_Operand>>;
+    using value_type = typename _Traits::value_type;
+
+    if constexpr (_Traits::size == 0) {
+        return value_type{};
+    } else if constexpr (_Traits::size <= constants::ARRAY_UNROLL_LIMIT) {
+        return _unrolledSum<value_type>(operand, std::make_index_sequence<_Traits::size>{});
+    } else {
+        // independent partial sums keep the loop vectorizable beyond the unroll limit
+        constexpr size_t lanes = 8;
+        value_type partial[lanes]{};
+
+        size_t idx = 0;
+        for (; idx + lanes <= _Traits::size; idx += lanes) {
+            for (size_t lane = 0; lane < lanes; lane++) {
+                partial[lane] += operand[idx + lane];
+            }
+        }
+        for (; idx < _Traits::size; idx++) {
+            partial[0] += operand[idx];
+        }
+
+        return ((partial[0] + partial[1]) + (partial[2] + partial[3])) + ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+    }
+}
+
+template<typename _Left, typename _Right>
+requires _ArrayOperand<_Left> && _ArrayOperand<_Right> && _ArrayOperands<_Left, _Right>
+constexpr auto dot(const _Left& left, const _Right& right) {
+    return sum(left * right);
+}
+
+// square root usable in constant expressions, where std::sqrt is not
+template<typename _Type>
+constexpr _Type _constexprSqrt(_Type value) {
+    if (!(value > _Type(0)) || value == value + value) {
+        // zero, negative, NaN or infinity
+        return value == _Type(0) || value == value + value ? value : std::numeric_limits<_Type>::quiet_NaN();
+    }
+
+    _Type current = value >= _Type(1) ? value : _Type(1);
+    _Type previous = _Type(0);
+    while (current != previous) {
+        previous = current;
+        current = (current + value / current) / _Type(2);
+        if (current >= previous) {
+            // Newton's iteration decreases monotonically until it converges
+            return previous;
+        }
+    }
+
+    return current;
+}
+
+// Euclidean (L2) norm
+template<_ArrayOperand _Operand>
+requires std::is_floating_point_v<typename _ArrayOperandTraits<std::remove_cvref_t<_Operand>>::value_type>
+constexpr auto norm(const _Operand& operand) {
+    const auto squares = dot(operand, operand);
+
+    if (std::is_constant_evaluated()) {
+        return _constexprSqrt(squares);
+    }
+
+    return std::sqrt(squares);
+}
+
+#endif // !ARRAYMATH_H
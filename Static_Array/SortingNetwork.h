@@ -0,0 +1,178 @@
+#ifndef SORTINGNETWORK_H
+#define SORTINGNETWORK_H
+
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// compile-time sorting networks used by Array::sort()
+//
+// A network is a fixed sequence of compare-exchange operations on index pairs. Because the sequence does not
+// depend on the data, it is expanded into straight-line code with no loops or data-dependent branches:
+// for arithmetic types every compare-exchange is a min/max pair. Sizes up to 8 use size-optimal networks,
+// larger sizes Batcher's odd-even merge sort, which is within a few comparators of the best known networks.
+
+namespace constants {
+    // Arrays up to this size are sorted by a network, larger ones by std::sort
+    constexpr size_t ARRAY_NETWORK_SORT_LIMIT = 32;
+}
+
+struct _SortComparator {
+    size_t _low;
+    size_t _high;
+};
+
+template<size_t _Count>
+struct _SortingNetwork {
+    size_t _size;
+    _SortComparator _comparators[_Count == 0 ? 1 : _Count];
+};
+
+// Batcher's odd-even merge sort over n elements; padding to a power of two is implicit, since comparators
+// reaching past n would only compare against +infinity and are left out. Calls emit(low, high) per comparator.
+template<typename _Emit>
+constexpr void _oddEvenMergeSort(size_t n, _Emit&& emit) {
+    for (size_t p = 1; p < n; p <<= 1) {
+        for (size_t k = p; k >= 1; k >>= 1) {
+            for (size_t j = k % p; j + k < n; j += 2 * k) {
+                for (size_t i = 0; i < k && i + j + k < n; i++) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        emit(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// size-optimal networks for up to 8 elements (Knuth, TAOCP vol. 3, 5.3.4)
+constexpr _SortComparator _optimalNetwork2[] = { {0, 1} };
+constexpr _SortComparator _optimalNetwork3[] = { {0, 2}, {0, 1}, {1, 2} };
+constexpr _SortComparator _optimalNetwork4[] = { {0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2} };
+constexpr _SortComparator _optimalNetwork5[] = {
+    {0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3}, {0, 2}, {1, 4}, {1, 3}, {1, 2}
+};
+constexpr _SortComparator _optimalNetwork6[] = {
+    {1, 2}, {4, 5}, {0, 2}, {3, 5}, {0, 1}, {3, 4}, {2, 5}, {0, 3}, {1, 4}, {2, 4}, {1, 3}, {2, 3}
+};
+constexpr _SortComparator _optimalNetwork7[] = {
+    {1, 2}, {3, 4}, {5, 6}, {0, 2}, {3, 5}, {4, 6}, {0, 1}, {4, 5},
+    {2, 6}, {0, 4}, {1, 5}, {0, 3}, {2, 5}, {1, 3}, {2, 4}, {2, 3}
+};
+constexpr _SortComparator _optimalNetwork8[] = {
+    {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3},
+    {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}
+};
+
+template<size_t _Size, typename _Emit>
+constexpr void _emitNetwork(_Emit&& emit) {
+    auto emitAll = [&emit](const auto& comparators) {
+        for (const _SortComparator& comparator : comparators) {
+            emit(comparator._low, comparator._high);
+        }
+    };
+
+    if constexpr (_Size == 2) {
+        emitAll(_optimalNetwork2);
+    } else if constexpr (_Size == 3) {
+        emitAll(_optimalNetwork3);
+    } else if constexpr (_Size == 4) {
+        emitAll(_optimalNetwork4);
+    } else if constexpr (_Size == 5) {
+        emitAll(_optimalNetwork5);
+    } else if constexpr (_Size == 6) {
+        emitAll(_optimalNetwork6);
+    } else if constexpr (_Size == 7) {
+        emitAll(_optimalNetwork7);
+    } else if constexpr (_Size == 8) {
+        emitAll(_optimalNetwork8);
+    } else {
+        _oddEvenMergeSort(_Size, emit);
+    }
+}
+
+template<size_t _Size>
+constexpr size_t _networkLength() {
+    size_t length = 0;
+    _emitNetwork<_Size>([&length](size_t, size_t) { length++; });
+
+    return length;
+}
+
+template<size_t _Size>
+constexpr _SortingNetwork<_networkLength<_Size>()> _makeNetwork() {
+    _SortingNetwork<_networkLength<_Size>()> network{};
+    _emitNetwork<_Size>([&network](size_t low, size_t high) {
+        network._comparators[network._size++] = { low, high };
+    });
+
+    return network;
+}
+
+template<size_t _Size>
+inline constexpr auto _sortingNetwork = _makeNetwork<_Size>();
+
+template<typename _Compare, typename _Type>
+inline constexpr bool _isLessCompare = std::is_same_v<_Compare, std::less<>> || std::is_same_v<_Compare, std::less<_Type>>;
+
+#ifdef __SSE2__
+// compilers keep a floating-point compare-and-select as a branch, so the ordering by operator< goes through
+// the SSE min/max instructions directly. minss(a, b) is a < b ? a : b and maxss(a, b) is a > b ? a : b, so
+// with the operands in this order both test second < first: a pair holding a NaN compares false and stays
+// as it is, instead of one value being copied over the other
+inline void _minMax(float& first, float& second) {
+    const __m128 left = _mm_set_ss(first), right = _mm_set_ss(second);
+    first = _mm_cvtss_f32(_mm_min_ss(right, left));
+    second = _mm_cvtss_f32(_mm_max_ss(left, right));
+}
+
+inline void _minMax(double& first, double& second) {
+    const __m128d left = _mm_set_sd(first), right = _mm_set_sd(second);
+    first = _mm_cvtsd_f64(_mm_min_sd(right, left));
+    second = _mm_cvtsd_f64(_mm_max_sd(left, right));
+}
+#endif
+
+// places the smaller of data[low] and data[high] at low; branch-free select for arithmetic types
+template<typename _Type, typename _Compare>
+constexpr void _compareExchange(_Type* data, size_t low, size_t high, _Compare& comp) {
+#ifdef __SSE2__
+    if constexpr ((std::is_same_v<_Type, float> || std::is_same_v<_Type, double>) && _isLessCompare<_Compare, _Type>) {
+        if (!std::is_constant_evaluated()) {
+            _minMax(data[low], data[high]);
+            return;
+        }
+    }
+#endif
+
+    if constexpr (std::is_arithmetic_v<_Type>) {
+        const _Type first = data[low];
+        const _Type second = data[high];
+
+        // written as two independent selects so they map onto min/max (or cmov) instructions
+        data[low] = comp(second, first) ? second : first;
+        data[high] = comp(second, first) ? first : second;
+    } else {
+        if (comp(data[high], data[low])) {
+            std::swap(data[low], data[high]);
+        }
+    }
+}
+
+template<size_t _Size, typename _Type, typename _Compare, size_t... _Idx>
+constexpr void _applyNetwork([[maybe_unused]] _Type* data, [[maybe_unused]] _Compare& comp, std::index_sequence<_Idx...>) {
+    [[maybe_unused]] constexpr auto& network = _sortingNetwork<_Size>;
+    (_compareExchange(data, network._comparators[_Idx]._low, network._comparators[_Idx]._high, comp), ...);
+}
+
+template<size_t _Size, typename _Type, typename _Compare>
+constexpr void _networkSort(_Type* data, _Compare& comp) {
+    _applyNetwork<_Size>(data, comp, std::make_index_sequence<_sortingNetwork<_Size>._size>{});
+}
+
+#endif // !SORTINGNETWORK_H
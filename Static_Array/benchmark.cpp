@@ -0,0 +1,158 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Array.h"
+#include "ArrayMath.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const std::string& name, double nanoseconds) {
+    std::cout << std::left << std::setw(36) << name << std::right 
+              << std::setw(12) << std::fixed << std::setprecision(2) << nanoseconds << " ns" << std::endl;
+}
+
+// ARRAY EQUALITY AND HASHING
+
+template<typename T, size_t N>
+bool loopEqual(const Array<T, N>& left, const Array<T, N>& right) {
+    for (size_t i = 0; i < N; i++) {
+        if (left[i] != right[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T, size_t N>
+void benchmarkEquality() {
+    const size_t iterations = 2'000'000;
+
+    Array<T, N> left, right;
+    left.fill(T(3));
+    right.fill(T(3));
+    right.back() = T(4);
+
+    const std::string suffix = " [" + std::to_string(sizeof(T) * 8) + "-bit x " + std::to_string(N) + "]";
+    printRow("loop operator==" + suffix, measureNs(iterations, [&] { doNotOptimize(loopEqual(left, right)); }));
+    printRow("Array operator==" + suffix, measureNs(iterations, [&] { doNotOptimize(left == right); }));
+    printRow("Array operator<" + suffix, measureNs(iterations, [&] { doNotOptimize(left < right); }));
+    printRow("Array::hash()" + suffix, measureNs(iterations, [&] { doNotOptimize(left.hash()); }));
+}
+
+// ARRAY EXPRESSION TEMPLATES
+
+template<typename T, size_t N>
+void handWrittenAxpy(Array<T, N>& result, const Array<T, N>& a, const Array<T, N>& b, const Array<T, N>& c) {
+    for (size_t i = 0; i < N; i++) {
+        result[i] = a[i] * b[i] + c[i];
+    }
+}
+
+template<typename T, size_t N>
+T handWrittenDot(const Array<T, N>& a, const Array<T, N>& b) {
+    T result{};
+    for (size_t i = 0; i < N; i++) {
+        result += a[i] * b[i];
+    }
+
+    return result;
+}
+
+template<typename T, size_t N>
+void benchmarkExpressions(const char* typeName) {
+    const size_t iterations = 20'000'000 / N + 1000;
+
+    Array<T, N> a, b, c, result;
+    for (size_t i = 0; i < N; i++) {
+        a[i] = T(i % 7) * T(0.5);
+        b[i] = T(i % 5) + T(1);
+        c[i] = T(i % 3);
+    }
+
+    const std::string suffix = std::string(" [") + typeName + " x " + std::to_string(N) + "]";
+    printRow("hand-written a * b + c" + suffix, measureNs(iterations, [&] { 
+        handWrittenAxpy(result, a, b, c); 
+        doNotOptimize(result); 
+    }));
+    printRow("expression a * b + c" + suffix, measureNs(iterations, [&] { 
+        result = a * b + c; 
+        doNotOptimize(result); 
+    }));
+    printRow("hand-written dot" + suffix, measureNs(iterations, [&] { doNotOptimize(handWrittenDot(a, b)); }));
+    printRow("dot(a, b)" + suffix, measureNs(iterations, [&] { doNotOptimize(dot(a, b)); }));
+}
+
+// ARRAY SORT
+
+template<typename T, size_t N>
+void benchmarkSort(const char* typeName) {
+    constexpr size_t batch = 4096;
+    const size_t rounds = 200;
+
+    // a batch of random arrays, re-copied before every sort so each sort sees unsorted input
+    std::mt19937 engine(42);
+    std::vector<Array<T, N>> inputs(batch), work(batch);
+    for (auto& arr : inputs) {
+        for (size_t i = 0; i < N; i++) {
+            arr[i] = static_cast<T>(engine() % 100000);
+        }
+    }
+
+    auto sortBatch = [&](auto&& sortOne) {
+        return measureNs(rounds, [&] {
+            work = inputs;
+            for (auto& arr : work) {
+                sortOne(arr);
+            }
+            doNotOptimize(work.back());
+        }) / batch;
+    };
+
+    const double copyNs = sortBatch([](Array<T, N>&) {});
+    const double stdNs = sortBatch([](Array<T, N>& arr) { std::sort(arr.begin(), arr.end()); });
+    const double arrayNs = sortBatch([](Array<T, N>& arr) { arr.sort(); });
+
+    const std::string suffix = std::string(" [") + typeName + " x " + std::to_string(N) + "]";
+    printRow("std::sort" + suffix, stdNs - copyNs);
+    printRow("Array::sort()" + suffix, arrayNs - copyNs);
+}
+
+int main() {
+    std::cout << "ARRAY EQUALITY, ORDERING AND HASHING\n" << std::endl;
+
+    benchmarkEquality<uint8_t, 32>();
+    benchmarkEquality<uint8_t, 1024>();
+    benchmarkEquality<uint32_t, 16>();
+    benchmarkEquality<uint32_t, 1024>();
+    benchmarkEquality<uint64_t, 256>();
+
+    std::cout << "\nARRAY EXPRESSION TEMPLATES\n" << std::endl;
+
+    benchmarkExpressions<float, 4>("float");
+    benchmarkExpressions<float, 16>("float");
+    benchmarkExpressions<float, 64>("float");
+    benchmarkExpressions<float, 1024>("float");
+    benchmarkExpressions<double, 3>("double");
+    benchmarkExpressions<double, 16>("double");
+    benchmarkExpressions<double, 256>("double");
+
+    std::cout << "\nARRAY SORT (per array, input copy excluded)\n" << std::endl;
+
+    benchmarkSort<int32_t, 4>("int32_t");
+    benchmarkSort<int32_t, 8>("int32_t");
+    benchmarkSort<int32_t, 12>("int32_t");
+    benchmarkSort<int32_t, 16>("int32_t");
+    benchmarkSort<int32_t, 24>("int32_t");
+    benchmarkSort<int32_t, 32>("int32_t");
+    benchmarkSort<float, 4>("float");
+    benchmarkSort<float, 8>("float");
+    benchmarkSort<float, 16>("float");
+    benchmarkSort<float, 32>("float");
+    benchmarkSort<double, 8>("double");
+    benchmarkSort<double, 16>("double");
+
+    return 0;
+}
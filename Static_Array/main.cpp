@@ -2,8 +2,15 @@
 #include <iomanip>
 #include <fstream>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
 
 #include "Array.h"
+#include "ArrayMath.h"
 
 struct Point3D {
     Point3D() : _x(0.0f), _y(0.0f), _z(0.0f) {
@@ -74,6 +81,168 @@ std::ostream& operator<<(std::ostream& out, const Point3D& point3d) {
     return out << "x=" << point3d._x << ", "  << "y=" << point3d._y << ", " << "z=" << point3d._z;
 }
 
+// writes the first and last element of result and whether it equals the same expression written as a loop
+template<typename T, size_t N>
+void writeExpression(const char* name, const Array<T, N>& result, const Array<T, N>& expected, std::ofstream& tFile) {
+    tFile << name << ": front() = " << result.front() << ", back() = " << result.back()
+          << (result == expected ? ", matches the loop" : ", DIFFERS from the loop") << std::endl;
+}
+
+template<typename T>
+void writeReduction(const char* name, T result, T expected, std::ofstream& tFile) {
+    tFile << name << " = " << result << (result == expected ? ", matches the loop" : ", DIFFERS from the loop") << std::endl;
+}
+
+// every expression on Arrays of N elements, checked against a loop; the values are small integers, so
+// evaluation order and fused multiply-adds cannot change a result
+template<size_t N>
+void testArrayMath(std::ofstream& tFile) {
+    tFile << "\nArray<double, " << N << ">, a[i] = i + 1, b[i] = " << N << " - i, c[i] = 2"
+          << (N <= constants::ARRAY_UNROLL_LIMIT ? ", unrolled" : ", past ARRAY_UNROLL_LIMIT") << std::endl;
+
+    Array<double, N> a, b, c, expected;
+    for (size_t i = 0; i < N; i++) {
+        a[i] = double(i + 1);
+        b[i] = double(N - i);
+        c[i] = 2.0;
+    }
+
+    Array<double, N> result = a + b;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = a[i] + b[i];
+    }
+    writeExpression("a + b", result, expected, tFile);
+
+    result = a * b - c;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = a[i] * b[i] - c[i];
+    }
+    writeExpression("a * b - c", result, expected, tFile);
+
+    result = (a - b) / c;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = (a[i] - b[i]) / c[i];
+    }
+    writeExpression("(a - b) / c", result, expected, tFile);
+
+    result = -a + 1.0;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = -a[i] + 1.0;
+    }
+    writeExpression("-a + 1.0", result, expected, tFile);
+
+    result = 3 * a;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = 3 * a[i];
+    }
+    writeExpression("3 * a", result, expected, tFile);
+
+    result = fma(a, b, c);
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = a[i] * b[i] + c[i];
+    }
+    writeExpression("fma(a, b, c)", result, expected, tFile);
+
+    result = a;
+    result += b;
+    result *= c;
+    for (size_t i = 0; i < N; i++) {
+        expected[i] = (a[i] + b[i]) * c[i];
+    }
+    writeExpression("result = a, result += b, result *= c", result, expected, tFile);
+
+    double loopSum = 0.0;
+    double loopDot = 0.0;
+    double loopSquares = 0.0;
+    for (size_t i = 0; i < N; i++) {
+        loopSum += a[i];
+        loopDot += a[i] * b[i];
+        loopSquares += c[i] * c[i];
+    }
+    writeReduction("sum(a)", sum(a), loopSum, tFile);
+    writeReduction("sum(a * c + b)", sum(a * c + b), 3 * loopSum, tFile); // b holds the elements of a in reverse
+    writeReduction("dot(a, b)", dot(a, b), loopDot, tFile);
+    writeReduction("norm(c)", norm(c), std::sqrt(loopSquares), tFile);
+
+    Array<int, N> ints;
+    int loopIntDot = 0;
+    for (size_t i = 0; i < N; i++) {
+        ints[i] = static_cast<int>(i % 7) - 3;
+        loopIntDot += ints[i] * ints[i];
+    }
+    writeReduction("dot(ints, ints) of Array<int> ints[i] = i % 7 - 3", dot(ints, ints), loopIntDot, tFile);
+}
+
+// the elements of arr in one line
+template<typename T, size_t N>
+void writeElements(const Array<T, N>& arr, std::ofstream& tFile) {
+    tFile << "{";
+    for (size_t i = 0; i < N; i++) {
+        tFile << (i == 0 ? " " : ", ") << arr[i];
+    }
+    tFile << " }";
+}
+
+// whether sorted holds the elements of input; NaNs never compare equal, so they are only counted
+template<typename T, size_t N>
+bool isPermutationOf(const Array<T, N>& sorted, const Array<T, N>& input) {
+    std::vector<T> sortedValues, inputValues;
+    for (size_t i = 0; i < N; i++) {
+        if (sorted[i] == sorted[i]) {
+            sortedValues.push_back(sorted[i]);
+        }
+        if (input[i] == input[i]) {
+            inputValues.push_back(input[i]);
+        }
+    }
+
+    return std::is_permutation(sortedValues.begin(), sortedValues.end(), inputValues.begin(), inputValues.end());
+}
+
+// sorts N pseudo-random values with Array::sort(comp) and checks the result against std::sort
+template<typename T, size_t N, typename Compare = std::less<>>
+void testSort(const char* typeName, std::ofstream& tFile, Compare comp = Compare()) {
+    Array<T, N> input;
+    unsigned seed = 12345u + static_cast<unsigned>(N);
+    for (size_t i = 0; i < N; i++) {
+        seed = seed * 1103515245u + 12345u;
+        if constexpr (std::is_same_v<T, std::string>) {
+            input[i] = std::to_string((seed >> 16) % 1000);
+        } else {
+            input[i] = static_cast<T>((seed >> 16) % 100);
+        }
+    }
+
+    Array<T, N> sorted = input;
+    sorted.sort(comp);
+    Array<T, N> expected = input;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    const char* method = N <= 8 ? "size-optimal network" :
+                         N <= constants::ARRAY_NETWORK_SORT_LIMIT ? "odd-even merge network" : "std::sort";
+    tFile << "Array<" << typeName << ", " << N << ">::sort(), " << method << ": ";
+    if (N <= 8) {
+        writeElements(sorted, tFile);
+        tFile << ", ";
+    }
+    tFile << (sorted == expected ? "matches std::sort" : "DIFFERS from std::sort") << std::endl;
+}
+
+// sorts values holding NaNs, which compare false both ways: the order is unspecified but no value may be lost
+template<typename T, size_t N>
+void testSortWithNaN(const Array<T, N>& input, std::ofstream& tFile) {
+    Array<T, N> sorted = input;
+    sorted.sort();
+
+    writeElements(input, tFile);
+    tFile << ".sort() = ";
+    if (N <= 8) {
+        writeElements(sorted, tFile);
+        tFile << ", ";
+    }
+    tFile << (isPermutationOf(sorted, input) ? "a permutation of the input" : "NOT a permutation of the input") << std::endl;
+}
+
 template<typename T, size_t N>
 void writeArray(const Array<T, N>& arr, std::ofstream& tFile) {
     tFile << "\nArray::size() = " << arr.size() << "\n" << std::endl;
@@ -202,5 +371,99 @@ int main() {
         writeArray(arr2, myArrayTestFile);
     }
 
+    // Array arithmetic expressions
+    {
+        myArrayTestFile << "\nARRAY ARITHMETIC EXPRESSIONS" << std::endl;
+
+        testArrayMath<1>(myArrayTestFile);
+        testArrayMath<7>(myArrayTestFile);
+        testArrayMath<constants::ARRAY_UNROLL_LIMIT>(myArrayTestFile);
+        testArrayMath<constants::ARRAY_UNROLL_LIMIT + 1>(myArrayTestFile);
+        testArrayMath<100>(myArrayTestFile);
+
+        constexpr Array<double, 3> threeFourFive = [] {
+            Array<double, 3> arr;
+            arr[0] = 3.0;
+            arr[1] = 4.0;
+            arr[2] = 12.0;
+            return arr;
+        }();
+        constexpr double constantNorm = norm(threeFourFive);
+        myArrayTestFile << "\nnorm({ 3, 4, 12 }) in a constant expression = " << constantNorm << std::endl;
+    }
+
+    // Array sort
+    {
+        myArrayTestFile << "\nARRAY SORT\n" << std::endl;
+
+        testSort<int, 2>("int", myArrayTestFile);
+        testSort<int, 3>("int", myArrayTestFile);
+        testSort<int, 4>("int", myArrayTestFile);
+        testSort<int, 5>("int", myArrayTestFile);
+        testSort<int, 6>("int", myArrayTestFile);
+        testSort<int, 7>("int", myArrayTestFile);
+        testSort<int, 8>("int", myArrayTestFile);
+        testSort<float, 8>("float", myArrayTestFile);
+        testSort<double, 5>("double", myArrayTestFile);
+        testSort<std::string, 6>("std::string", myArrayTestFile, [](const std::string& left, const std::string& right) {
+            return left.size() < right.size() || (left.size() == right.size() && left < right);
+        });
+        testSort<int, 7>("int", myArrayTestFile, std::greater<>());
+
+        testSort<int, 9>("int", myArrayTestFile);
+        testSort<int, 13>("int", myArrayTestFile);
+        testSort<int, 16>("int", myArrayTestFile);
+        testSort<float, 24>("float", myArrayTestFile);
+        testSort<double, 31>("double", myArrayTestFile);
+        testSort<int, constants::ARRAY_NETWORK_SORT_LIMIT>("int", myArrayTestFile);
+        testSort<double, constants::ARRAY_NETWORK_SORT_LIMIT>("double", myArrayTestFile, std::greater<>());
+
+        testSort<int, constants::ARRAY_NETWORK_SORT_LIMIT + 1>("int", myArrayTestFile);
+        testSort<double, 100>("double", myArrayTestFile);
+
+        constexpr Array<int, 5> constantSorted = [] {
+            Array<int, 5> arr;
+            for (size_t i = 0; i < arr.size(); i++) {
+                arr[i] = static_cast<int>(arr.size() - i);
+            }
+            arr.sort();
+            return arr;
+        }();
+        myArrayTestFile << "Array<int, 5>{ 5, 4, 3, 2, 1 }.sort() in a constant expression: ";
+        writeElements(constantSorted, myArrayTestFile);
+        myArrayTestFile << std::endl;
+
+        myArrayTestFile << "\nsorting values that include NaN\n" << std::endl;
+
+        const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        Array<double, 2> pair;
+        pair[0] = NaN;
+        pair[1] = 5.0;
+        testSortWithNaN(pair, myArrayTestFile);
+        pair[0] = 5.0;
+        pair[1] = NaN;
+        testSortWithNaN(pair, myArrayTestFile);
+
+        Array<double, 4> four;
+        four[0] = 3.0;
+        four[1] = NaN;
+        four[2] = 1.0;
+        four[3] = 2.0;
+        testSortWithNaN(four, myArrayTestFile);
+
+        Array<float, 8> floats;
+        for (size_t i = 0; i < floats.size(); i++) {
+            floats[i] = i % 3 == 1 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(floats.size() - i);
+        }
+        testSortWithNaN(floats, myArrayTestFile);
+
+        Array<double, 20> doubles;
+        for (size_t i = 0; i < doubles.size(); i++) {
+            doubles[i] = i % 4 == 0 ? NaN : static_cast<double>((i * 7) % 11);
+        }
+        testSortWithNaN(doubles, myArrayTestFile);
+    }
+
     return 0;
 }
@@ -0,0 +1,310 @@
+#ifndef STATICMAP_H
+#define STATICMAP_H
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "../Static_Array/Array.h"
+
+namespace constants {
+    // the number of displacement seeds tried for one bucket before StaticMap construction gives up
+    constexpr uint64_t STATIC_MAP_MAX_SEED_ATTEMPTS = 1 << 20;
+}
+
+// constexpr hash used by StaticMap; specialize it to support further key types
+
+template<typename _Key>
+struct StaticMapHash;
+
+template<typename _Key>
+requires std::is_integral_v<_Key> || std::is_enum_v<_Key>
+struct StaticMapHash<_Key> {
+    constexpr uint64_t operator()(_Key key) const {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+template<>
+struct StaticMapHash<std::string_view> {
+    // reads only fixed-width words, overlapping at the tail, so there are no per-byte loops at runtime
+    constexpr uint64_t operator()(std::string_view key) const {
+        const size_t size = key.size();
+        uint64_t hash = 0x9e3779b97f4a7c15ull ^ size;
+        uint64_t tail = 0;
+
+        if (size >= 8) {
+            for (size_t idx = 0; idx + 8 < size; idx += 8) {
+                hash = (hash ^ _load<8>(key, idx)) * 0xff51afd7ed558ccdull;
+                hash ^= hash >> 32;
+            }
+            tail = _load<8>(key, size - 8);
+        } else if (size >= 4) {
+            tail = (_load<4>(key, 0) << 32) | _load<4>(key, size - 4);
+        } else if (size > 0) {
+            tail = (_load<1>(key, 0) << 16) | (_load<1>(key, size / 2) << 8) | _load<1>(key, size - 1);
+        }
+
+        hash = (hash ^ tail) * 0xc4ceb9fe1a85ec53ull;
+        return hash ^ (hash >> 29);
+    }
+
+private:
+    template<size_t... _Idx>
+    static constexpr uint64_t _loadBytes(std::string_view key, size_t first, std::index_sequence<_Idx...>) {
+        return ((static_cast<uint64_t>(static_cast<unsigned char>(key[first + _Idx])) << (8 * _Idx)) | ...);
+    }
+
+    // little-endian word of _Bytes bytes starting at first
+    template<size_t _Bytes>
+    static constexpr uint64_t _load(std::string_view key, size_t first) {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (!std::is_constant_evaluated()) {
+                uint64_t word = 0;
+                std::memcpy(&word, key.data() + first, _Bytes);
+                return word;
+            }
+        }
+
+        return _loadBytes(key, first, std::make_index_sequence<_Bytes>{});
+    }
+};
+
+// interface of an immutable map whose keys are all known at compile time.
+// The constructor builds a minimal perfect hash (hash and displace): keys are grouped into buckets by one
+// hash, then every bucket gets a seed under which its keys land on distinct free slots of a table with
+// exactly _Size slots. Buckets holding a single key store their slot directly. A lookup is therefore one
+// seed read, one slot computation and one key comparison, and a constexpr StaticMap needs no dynamic
+// initialization at all.
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash = StaticMapHash<_Key>>
+class StaticMap {
+public:
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using value_type = std::pair<_Key, _Value>;
+    using const_iterator = typename Array<value_type, _Size>::const_iterator;
+
+    // ctors
+    constexpr explicit StaticMap(const value_type (&items)[_Size]);
+
+    constexpr explicit StaticMap(const Array<value_type, _Size>& items);
+
+    // lookup
+    constexpr const _Value* find(const _Key& key) const;
+
+    constexpr bool contains(const _Key& key) const;
+
+    constexpr const _Value& at(const _Key& key) const;
+
+    // iterators (in slot order)
+    constexpr const_iterator cbegin() const;
+
+    constexpr const_iterator cend() const;
+
+    // capacity
+    constexpr bool empty() const;
+
+    constexpr size_t size() const;
+
+private:
+    static constexpr uint64_t _mix(uint64_t hash);
+
+    static constexpr size_t _bucketOf(uint64_t mixed);
+
+    static constexpr size_t _slotOf(uint64_t mixed, uint64_t seed);
+
+    template<typename _Items>
+    constexpr void _build(const _Items& items);
+
+private:
+    Array<value_type, _Size> _slots; // the key-value pairs, placed by the perfect hash
+    Array<int64_t, _Size> _seeds; // per bucket: seed + 1 when positive, -(slot + 1) when negative, 0 when empty
+};
+
+// StaticMap definition
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr uint64_t StaticMap<_Key, _Value, _Size, _Hash>::_mix(uint64_t hash) {
+    // splitmix64 finalizer
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ull;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebull;
+    hash ^= hash >> 31;
+
+    return hash;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr size_t StaticMap<_Key, _Value, _Size, _Hash>::_bucketOf(uint64_t mixed) {
+    return (mixed >> 32) % _Size;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr size_t StaticMap<_Key, _Value, _Size, _Hash>::_slotOf(uint64_t mixed, uint64_t seed) {
+    // a single multiply per seed, the expensive mixing of the key hash is shared with the bucket choice
+    return (((mixed ^ (seed * 0x9e3779b97f4a7c15ull)) * 0xd6e8feb86659fd93ull) >> 32) % _Size;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+template<typename _Items>
+constexpr void StaticMap<_Key, _Value, _Size, _Hash>::_build(const _Items& items) {
+    Array<uint64_t, _Size> hashes{};
+    Array<size_t, _Size> bucketSizes{};
+    for (size_t i = 0; i < _Size; i++) {
+        hashes[i] = _mix(_Hash{}(items[i].first));
+        bucketSizes[_bucketOf(hashes[i])]++;
+    }
+
+    // counting sort of the keys by bucket
+    Array<size_t, _Size> bucketStarts{};
+    for (size_t b = 1; b < _Size; b++) {
+        bucketStarts[b] = bucketStarts[b - 1] + bucketSizes[b - 1];
+    }
+
+    Array<size_t, _Size> keysByBucket{};
+    Array<size_t, _Size> filled{};
+    for (size_t i = 0; i < _Size; i++) {
+        const size_t bucket = _bucketOf(hashes[i]);
+        keysByBucket[bucketStarts[bucket] + filled[bucket]++] = i;
+    }
+
+    // the largest buckets are the hardest to place, so they go first while the table is still empty
+    Array<size_t, _Size> bucketOrder{};
+    for (size_t b = 0; b < _Size; b++) {
+        bucketOrder[b] = b;
+    }
+    std::sort(bucketOrder.begin(), bucketOrder.end(), [&bucketSizes](size_t left, size_t right) {
+        return bucketSizes[left] > bucketSizes[right];
+    });
+
+    Array<bool, _Size> occupied{};
+    size_t freeSlot = 0;
+
+    for (size_t bucket : bucketOrder) {
+        const size_t first = bucketStarts[bucket];
+        const size_t count = bucketSizes[bucket];
+
+        if (count == 0) {
+            break;
+        }
+
+        if (count == 1) {
+            while (occupied[freeSlot]) {
+                freeSlot++;
+            }
+
+            occupied[freeSlot] = true;
+            _slots[freeSlot] = items[keysByBucket[first]];
+            _seeds[bucket] = -static_cast<int64_t>(freeSlot) - 1;
+            continue;
+        }
+
+        for (uint64_t seed = 0; ; seed++) {
+            if (seed == constants::STATIC_MAP_MAX_SEED_ATTEMPTS) {
+                throw std::logic_error("StaticMap Error: No perfect hash found, are the keys unique?");
+            }
+
+            // the candidate slots must be free and distinct from each other
+            size_t placed = 0;
+            for (; placed < count; placed++) {
+                const size_t slot = _slotOf(hashes[keysByBucket[first + placed]], seed);
+                if (occupied[slot]) {
+                    break;
+                }
+                occupied[slot] = true;
+            }
+
+            if (placed == count) {
+                for (size_t k = 0; k < count; k++) {
+                    const size_t key = keysByBucket[first + k];
+                    _slots[_slotOf(hashes[key], seed)] = items[key];
+                }
+
+                _seeds[bucket] = static_cast<int64_t>(seed) + 1;
+                break;
+            }
+
+            for (size_t k = 0; k < placed; k++) {
+                occupied[_slotOf(hashes[keysByBucket[first + k]], seed)] = false;
+            }
+        }
+    }
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr StaticMap<_Key, _Value, _Size, _Hash>::StaticMap(const value_type (&items)[_Size]) : _slots(), _seeds() {
+    _build(items);
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr StaticMap<_Key, _Value, _Size, _Hash>::StaticMap(const Array<value_type, _Size>& items) : _slots(), _seeds() {
+    _build(items);
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr const _Value* StaticMap<_Key, _Value, _Size, _Hash>::find(const _Key& key) const {
+    if constexpr (_Size == 0) {
+        return nullptr;
+    } else {
+        const uint64_t hash = _mix(_Hash{}(key));
+        const int64_t seed = _seeds[_bucketOf(hash)];
+        const size_t slot = seed < 0 ? static_cast<size_t>(-seed - 1) : _slotOf(hash, static_cast<uint64_t>(seed - 1));
+
+        // keys of empty buckets still probe some slot, the comparison rejects them
+        return _slots[slot].first == key ? &_slots[slot].second : nullptr;
+    }
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr bool StaticMap<_Key, _Value, _Size, _Hash>::contains(const _Key& key) const {
+    return find(key) != nullptr;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr const _Value& StaticMap<_Key, _Value, _Size, _Hash>::at(const _Key& key) const {
+    const _Value* value = find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("StaticMap Error: Key not found!");
+    }
+
+    return *value;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr typename StaticMap<_Key, _Value, _Size, _Hash>::const_iterator StaticMap<_Key, _Value, _Size, _Hash>::cbegin() const {
+    return _slots.cbegin();
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr typename StaticMap<_Key, _Value, _Size, _Hash>::const_iterator StaticMap<_Key, _Value, _Size, _Hash>::cend() const {
+    return _slots.cend();
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr bool StaticMap<_Key, _Value, _Size, _Hash>::empty() const {
+    return _Size == 0;
+}
+
+template<typename _Key, typename _Value, size_t _Size, typename _Hash>
+constexpr size_t StaticMap<_Key, _Value, _Size, _Hash>::size() const {
+    return _Size;
+}
+
+// deduces the key count from the braced list: makeStaticMap<std::string_view, int>({ {"if", 1}, {"else", 2} })
+template<typename _Key, typename _Value, size_t _Size>
+constexpr StaticMap<_Key, _Value, _Size> makeStaticMap(const std::pair<_Key, _Value> (&items)[_Size]) {
+    return StaticMap<_Key, _Value, _Size>(items);
+}
+
+template<typename _Key, typename _Value, size_t _Size>
+constexpr StaticMap<_Key, _Value, _Size> makeStaticMap(const Array<std::pair<_Key, _Value>, _Size>& items) {
+    return StaticMap<_Key, _Value, _Size>(items);
+}
+
+#endif // !STATICMAP_H
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <string_view>
+#include <unordered_map>
+
+#include "StaticMap.h"
+#include "../Utility/Benchmark.h"
+
+void printRow(const char* name, double nanoseconds) {
+    std::cout << std::left << std::setw(44) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << nanoseconds << " ns" << std::endl;
+}
+
+constexpr std::pair<std::string_view, int> KEYWORDS[] = {
+    { "alignas", 0 }, { "alignof", 1 }, { "auto", 2 }, { "bool", 3 }, { "break", 4 }, { "case", 5 },
+    { "catch", 6 }, { "char", 7 }, { "class", 8 }, { "const", 9 }, { "constexpr", 10 }, { "continue", 11 },
+    { "decltype", 12 }, { "default", 13 }, { "delete", 14 }, { "do", 15 }, { "double", 16 }, { "else", 17 },
+    { "enum", 18 }, { "explicit", 19 }, { "extern", 20 }, { "false", 21 }, { "float", 22 }, { "for", 23 },
+    { "friend", 24 }, { "goto", 25 }, { "if", 26 }, { "inline", 27 }, { "int", 28 }, { "long", 29 },
+    { "mutable", 30 }, { "namespace", 31 }, { "new", 32 }, { "noexcept", 33 }, { "nullptr", 34 },
+    { "operator", 35 }, { "private", 36 }, { "protected", 37 }, { "public", 38 }, { "return", 39 },
+    { "short", 40 }, { "signed", 41 }, { "sizeof", 42 }, { "static", 43 }, { "struct", 44 }, { "switch", 45 },
+    { "template", 46 }, { "this", 47 }, { "throw", 48 }, { "true", 49 }, { "try", 50 }, { "typedef", 51 },
+    { "typename", 52 }, { "union", 53 }, { "unsigned", 54 }, { "using", 55 }, { "virtual", 56 },
+    { "void", 57 }, { "volatile", 58 }, { "while", 59 }
+};
+
+constexpr auto keywordMap = makeStaticMap(KEYWORDS);
+
+constexpr size_t INT_KEYS = 1024;
+
+constexpr Array<std::pair<uint32_t, uint32_t>, INT_KEYS> makeIntItems() {
+    Array<std::pair<uint32_t, uint32_t>, INT_KEYS> items{};
+    for (uint32_t i = 0; i < INT_KEYS; i++) {
+        items[i] = { i * 2654435761u, i };
+    }
+
+    return items;
+}
+
+constexpr auto intMap = makeStaticMap(makeIntItems());
+
+int main() {
+    const size_t lookups = 1 << 16;
+    const size_t rounds = 200;
+    std::mt19937 engine(7);
+
+    std::cout << "STATIC MAP VS STD::UNORDERED_MAP (average per lookup)\n" << std::endl;
+
+    // string_view keys: a stream of identifiers where roughly half are keywords
+    {
+        const std::string_view identifiers[] = { "x", "value", "count", "it", "result", "buffer", "size", "idx" };
+        std::vector<std::string_view> probes(lookups);
+        for (auto& probe : probes) {
+            probe = engine() % 2 ? KEYWORDS[engine() % std::size(KEYWORDS)].first : identifiers[engine() % std::size(identifiers)];
+        }
+
+        std::unordered_map<std::string_view, int> hashMap;
+        printRow("std::unordered_map construction (60 keys)", measureNs(1000, [&] {
+            std::unordered_map<std::string_view, int> built(std::begin(KEYWORDS), std::end(KEYWORDS));
+            doNotOptimize(built.size());
+            hashMap = std::move(built);
+        }));
+
+        printRow("std::unordered_map<string_view> find", measureNs(rounds, [&] {
+            int sum = 0;
+            for (std::string_view probe : probes) {
+                auto it = hashMap.find(probe);
+                sum += it != hashMap.end() ? it->second : -1;
+            }
+            doNotOptimize(sum);
+        }) / lookups);
+
+        printRow("StaticMap<string_view> find", measureNs(rounds, [&] {
+            int sum = 0;
+            for (std::string_view probe : probes) {
+                const int* value = keywordMap.find(probe);
+                sum += value ? *value : -1;
+            }
+            doNotOptimize(sum);
+        }) / lookups);
+    }
+
+    // integer keys, all hits
+    {
+        const auto items = makeIntItems();
+        std::vector<uint32_t> probes(lookups);
+        for (auto& probe : probes) {
+            probe = items[engine() % INT_KEYS].first;
+        }
+
+        std::unordered_map<uint32_t, uint32_t> hashMap(items.cbegin(), items.cend());
+
+        printRow("std::unordered_map<uint32_t> find (1024 keys)", measureNs(rounds, [&] {
+            uint32_t sum = 0;
+            for (uint32_t probe : probes) {
+                sum += hashMap.find(probe)->second;
+            }
+            doNotOptimize(sum);
+        }) / lookups);
+
+        printRow("StaticMap<uint32_t> find (1024 keys)", measureNs(rounds, [&] {
+            uint32_t sum = 0;
+            for (uint32_t probe : probes) {
+                sum += *intMap.find(probe);
+            }
+            doNotOptimize(sum);
+        }) / lookups);
+    }
+
+    return 0;
+}
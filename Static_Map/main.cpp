@@ -0,0 +1,73 @@
+#include <iostream>
+#include <fstream>
+#include <string_view>
+
+#include "StaticMap.h"
+
+enum class Token { If, Else, For, While, Do, Return, Break, Continue };
+
+constexpr auto keywords = makeStaticMap<std::string_view, Token>({
+    { "if", Token::If }, { "else", Token::Else }, { "for", Token::For }, { "while", Token::While },
+    { "do", Token::Do }, { "return", Token::Return }, { "break", Token::Break }, { "continue", Token::Continue }
+});
+
+constexpr auto httpStatus = makeStaticMap<int, std::string_view>({
+    { 200, "OK" }, { 201, "Created" }, { 204, "No Content" }, { 301, "Moved Permanently" }, { 304, "Not Modified" },
+    { 400, "Bad Request" }, { 401, "Unauthorized" }, { 403, "Forbidden" }, { 404, "Not Found" },
+    { 500, "Internal Server Error" }, { 503, "Service Unavailable" }
+});
+
+// lookups are usable in constant expressions as well
+static_assert(keywords.at("while") == Token::While);
+static_assert(!keywords.contains("goto"));
+static_assert(httpStatus.at(404) == "Not Found");
+
+int main() {
+    std::ofstream myStaticMapTestFile("StaticMapTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myStaticMapTestFile << "STATIC MAP LOOKUP\n" << std::endl;
+
+    // string_view keys
+    {
+        myStaticMapTestFile << "Keyword map, StaticMap::size() = " << keywords.size() << std::endl;
+
+        for (std::string_view word : { "if", "while", "continue", "goto", "iff", "" }) {
+            const Token* token = keywords.find(word);
+
+            myStaticMapTestFile << "find(\"" << word << "\") -> ";
+            token ? myStaticMapTestFile << static_cast<int>(*token) << std::endl : 
+                    myStaticMapTestFile << "not found" << std::endl;
+        }
+    }
+
+    // integer keys
+    {
+        myStaticMapTestFile << "\nHTTP status map, StaticMap::size() = " << httpStatus.size() << std::endl;
+
+        for (int code : { 200, 304, 404, 418, 503 }) {
+            myStaticMapTestFile << "contains(" << code << ") = " << std::boolalpha << httpStatus.contains(code);
+            if (httpStatus.contains(code)) {
+                myStaticMapTestFile << ", at(" << code << ") = " << httpStatus.at(code);
+            }
+            myStaticMapTestFile << std::endl;
+        }
+
+        try {
+            httpStatus.at(418);
+        } catch (const std::out_of_range& error) {
+            myStaticMapTestFile << "at(418) threw: " << error.what() << std::endl;
+        }
+    }
+
+    // iteration in slot order
+    {
+        myStaticMapTestFile << "\nHTTP status map in slot order" << std::endl;
+        for (auto it = httpStatus.cbegin(); it != httpStatus.cend(); ++it) {
+            myStaticMapTestFile << it->first << " " << it->second << std::endl;
+        }
+    }
+
+    myStaticMapTestFile.close();
+
+    return 0;
+}
@@ -0,0 +1,321 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "../Utility/CacheLine.h"
+#include "../Utility/ParkingLot.h"
+#include "../Work_Stealing_Deque/WorkStealingDeque.h"
+#include "../Double_Ended_Queue_GNU_Version/Deque.h"
+
+namespace constants {
+    // failed searches for work before an idle worker parks
+    constexpr size_t THREAD_POOL_SPIN_ROUNDS = 128;
+    constexpr size_t DEFAULT_PARALLEL_FOR_GRAIN = 1;
+}
+
+// interface of a fixed-size work-stealing thread pool.
+// Every worker owns a WorkStealingDeque: tasks spawned on a worker go to its own deque and it runs
+// them newest first, while idle workers steal the oldest tasks of a randomly chosen victim. Tasks
+// submitted from outside the pool go through one locked injection queue. An idle worker spins for
+// THREAD_POOL_SPIN_ROUNDS searches and then parks in a ParkingLot; submitters only touch its wake-up
+// word when some worker is parked.
+// Fork/join goes through TaskGroup: spawn() forks, sync() joins and runs other tasks while it waits,
+// so nested groups never block a worker. All groups must be synced before the pool is destroyed.
+
+class ThreadPool {
+private:
+    struct _Task;
+
+public:
+    class TaskGroup {
+    public:
+        explicit TaskGroup(ThreadPool& pool);
+
+        TaskGroup(const TaskGroup& source) = delete;
+
+        // dtor, syncs
+        ~TaskGroup();
+
+        TaskGroup& operator=(const TaskGroup& right) = delete;
+
+        template<typename Func>
+        void spawn(Func&& func);
+
+        // returns once every task spawned in the group has finished
+        void sync();
+
+    private:
+        friend class ThreadPool;
+
+        ThreadPool& _pool;
+        std::atomic<size_t> _pending; // spawned and not yet finished
+    };
+
+    // ctors
+    explicit ThreadPool(size_t workersCount = std::max(1u, std::thread::hardware_concurrency()));
+
+    ThreadPool(const ThreadPool& source) = delete;
+
+    // dtor
+    ~ThreadPool();
+
+    // operator=
+    ThreadPool& operator=(const ThreadPool& right) = delete;
+
+    // observers
+    size_t workers() const;
+
+    // operations
+    // calls func(i) for every i in [first, last), in tasks of at most grain indices, and waits for all of them
+    template<typename Func>
+    void parallel_for(size_t first, size_t last, Func&& func, size_t grain = constants::DEFAULT_PARALLEL_FOR_GRAIN);
+
+private:
+    struct _Task {
+        std::function<void()> _func;
+        TaskGroup* _group;
+    };
+
+    struct alignas(constants::CACHE_LINE_SIZE) _Worker {
+        WorkStealingDeque<_Task*> _tasks;
+        uint64_t _victimSeed = 0; // xorshift state for picking victims
+        std::thread _thread;
+    };
+
+    static constexpr size_t _NOT_A_WORKER = SIZE_MAX;
+
+    size_t _currentWorker() const;
+
+    void _submit(_Task* task);
+
+    _Task* _findTask(size_t self);
+
+    _Task* _stealTask(size_t self);
+
+    bool _hasWork() const;
+
+    static void _run(_Task* task);
+
+    void _workerLoop(size_t index);
+
+    static void _pause();
+
+    template<typename Func>
+    void _splitRange(TaskGroup& group, size_t first, size_t last, size_t grain, Func& func);
+
+private:
+    const size_t _workersCount;
+    std::unique_ptr<_Worker[]> _workers;
+
+    std::mutex _injectedMutex;
+    Deque<_Task*> _injected; // tasks submitted from outside the pool
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<size_t> _injectedCount;
+
+    alignas(constants::CACHE_LINE_SIZE) ParkingLot _idleWorkers;
+    std::atomic<bool> _stopping;
+
+    inline static thread_local const ThreadPool* _currentPool = nullptr;
+    inline static thread_local size_t _currentIndex = 0;
+};
+
+// ThreadPool definition
+
+inline ThreadPool::TaskGroup::TaskGroup(ThreadPool& pool) : _pool(pool), _pending(0) {}
+
+inline ThreadPool::TaskGroup::~TaskGroup() {
+    sync();
+}
+
+template<typename Func>
+void ThreadPool::TaskGroup::spawn(Func&& func) {
+    _pending.fetch_add(1, std::memory_order_relaxed);
+    _pool._submit(new _Task{ std::function<void()>(std::forward<Func>(func)), this });
+}
+
+inline void ThreadPool::TaskGroup::sync() {
+    const size_t self = _pool._currentWorker();
+
+    while (_pending.load(std::memory_order_acquire) > 0) {
+        // help instead of blocking: the tasks this group waits for may be queued behind this thread
+        if (_Task* task = _pool._findTask(self)) {
+            _run(task);
+        } else if (self != _NOT_A_WORKER) {
+            _pause();
+        } else {
+            // a thread outside the pool gives its core to the workers
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline ThreadPool::ThreadPool(size_t workersCount) :
+    _workersCount(std::max<size_t>(workersCount, 1)), _workers(new _Worker[_workersCount]),
+    _injectedMutex(), _injected(), _injectedCount(0), _idleWorkers(), _stopping(false) {
+    for (size_t i = 0; i < _workersCount; i++) {
+        _workers[i]._victimSeed = 0x9E3779B97F4A7C15ull * (i + 1);
+    }
+    for (size_t i = 0; i < _workersCount; i++) {
+        _workers[i]._thread = std::thread(&ThreadPool::_workerLoop, this, i);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    _stopping.store(true, std::memory_order_seq_cst);
+    _idleWorkers.notify_all();
+
+    for (size_t i = 0; i < _workersCount; i++) {
+        _workers[i]._thread.join();
+    }
+}
+
+inline size_t ThreadPool::workers() const {
+    return _workersCount;
+}
+
+template<typename Func>
+void ThreadPool::parallel_for(size_t first, size_t last, Func&& func, size_t grain) {
+    TaskGroup group(*this);
+    if (first < last) {
+        _splitRange(group, first, last, std::max<size_t>(grain, 1), func);
+    }
+    group.sync();
+}
+
+template<typename Func>
+void ThreadPool::_splitRange(TaskGroup& group, size_t first, size_t last, size_t grain, Func& func) {
+    // hand the upper half to a task and keep splitting the lower one, so thieves take the big pieces
+    while (last - first > grain) {
+        const size_t middle = first + (last - first) / 2;
+        group.spawn([this, &group, middle, last, grain, &func] {
+            _splitRange(group, middle, last, grain, func);
+        });
+        last = middle;
+    }
+
+    for (; first < last; first++) {
+        func(first);
+    }
+}
+
+inline size_t ThreadPool::_currentWorker() const {
+    return _currentPool == this ? _currentIndex : _NOT_A_WORKER;
+}
+
+inline void ThreadPool::_submit(_Task* task) {
+    const size_t self = _currentWorker();
+
+    if (self != _NOT_A_WORKER) {
+        _workers[self]._tasks.push(task);
+    } else {
+        std::lock_guard<std::mutex> lock(_injectedMutex);
+        _injected.push_back(task);
+        _injectedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    _idleWorkers.notify_one();
+}
+
+inline ThreadPool::_Task* ThreadPool::_findTask(size_t self) {
+    _Task* task = nullptr;
+
+    if (self != _NOT_A_WORKER && _workers[self]._tasks.try_pop(task)) {
+        return task;
+    }
+
+    if (_injectedCount.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(_injectedMutex);
+        if (!_injected.empty()) {
+            task = _injected.front();
+            _injected.pop_front();
+            _injectedCount.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    return _stealTask(self);
+}
+
+inline ThreadPool::_Task* ThreadPool::_stealTask(size_t self) {
+    // start at a random victim so thieves spread out instead of all hitting worker 0
+    thread_local uint64_t externalSeed = 0x2545F4914F6CDD1Dull;
+    uint64_t& seed = self != _NOT_A_WORKER ? _workers[self]._victimSeed : externalSeed;
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    const size_t start = seed % _workersCount;
+    _Task* task = nullptr;
+
+    for (size_t i = 0; i < _workersCount; i++) {
+        const size_t victim = (start + i) % _workersCount;
+        if (victim != self && _workers[victim]._tasks.try_steal(task)) {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+inline bool ThreadPool::_hasWork() const {
+    if (_injectedCount.load(std::memory_order_relaxed) > 0) {
+        return true;
+    }
+
+    for (size_t i = 0; i < _workersCount; i++) {
+        if (!_workers[i]._tasks.empty()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void ThreadPool::_run(_Task* task) {
+    task->_func();
+
+    // the group outlives the task only until _pending drops, so the task is freed first
+    TaskGroup* group = task->_group;
+    delete task;
+    group->_pending.fetch_sub(1, std::memory_order_release);
+}
+
+inline void ThreadPool::_workerLoop(size_t index) {
+    _currentPool = this;
+    _currentIndex = index;
+
+    size_t idleRounds = 0;
+    while (true) {
+        if (_Task* task = _findTask(index)) {
+            _run(task);
+            idleRounds = 0;
+        } else if (_stopping.load(std::memory_order_acquire)) {
+            break;
+        } else if (++idleRounds < constants::THREAD_POOL_SPIN_ROUNDS) {
+            _pause();
+        } else {
+            _idleWorkers.park([this] { return _hasWork() || _stopping.load(std::memory_order_acquire); });
+            idleRounds = 0;
+        }
+    }
+}
+
+inline void ThreadPool::_pause() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+#endif // !THREADPOOL_H
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+#include "ThreadPool.h"
+#include "../Utility/Benchmark.h"
+
+constexpr size_t MAX_WORKERS = 64;
+constexpr size_t TASKS = 1 << 18;
+constexpr unsigned TASK_WORK_ROUNDS = 32; // a few dozen nanoseconds of work per task
+constexpr unsigned FIBONACCI_N = 27;
+constexpr unsigned FIBONACCI_CUTOFF = 8; // below it fibonacci recurses without spawning
+
+// baseline: the single locked queue with a condition variable that the pool replaces
+class LockedQueuePool {
+public:
+    explicit LockedQueuePool(size_t workersCount) {
+        for (size_t i = 0; i < workersCount; i++) {
+            _threads.emplace_back([this] {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (true) {
+                    _ready.wait(lock, [this] { return _stopping || !_queue.empty(); });
+                    if (_queue.empty()) {
+                        return;
+                    }
+
+                    std::function<void()> task = std::move(_queue.front());
+                    _queue.pop_front();
+                    lock.unlock();
+                    task();
+                    lock.lock();
+
+                    if (--_pending == 0) {
+                        _idle.notify_all();
+                    }
+                }
+            });
+        }
+    }
+
+    ~LockedQueuePool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _ready.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queue.push_back(std::move(task));
+            _pending++;
+        }
+        _ready.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idle.wait(lock, [this] { return _pending == 0; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::condition_variable _idle;
+    Deque<std::function<void()>> _queue;
+    size_t _pending = 0;
+    bool _stopping = false;
+    std::vector<std::thread> _threads;
+};
+
+inline uint64_t taskWork(uint64_t seed) {
+    for (unsigned i = 0; i < TASK_WORK_ROUNDS; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+    }
+
+    return seed;
+}
+
+uint64_t fibonacci(ThreadPool& pool, unsigned n) {
+    if (n < FIBONACCI_CUTOFF) {
+        return n < 2 ? n : fibonacci(pool, n - 1) + fibonacci(pool, n - 2);
+    }
+
+    uint64_t left = 0;
+    ThreadPool::TaskGroup group(pool);
+    group.spawn([&pool, &left, n] {
+        left = fibonacci(pool, n - 1);
+    });
+    const uint64_t right = fibonacci(pool, n - 2);
+    group.sync();
+
+    return left + right;
+}
+
+// tasks spawned by fibonacci(n), one per call at or above the cutoff
+uint64_t fibonacciTasks(unsigned n) {
+    return n < FIBONACCI_CUTOFF ? 0 : 1 + fibonacciTasks(n - 1) + fibonacciTasks(n - 2);
+}
+
+template<typename Func>
+double measureSeconds(Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+void printRow(const char* name, size_t workersCount, double tasksPerSecond) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::setw(4) << workersCount << " workers"
+              << std::setw(12) << std::fixed << std::setprecision(2) << tasksPerSecond / 1e6 << " Mtasks/s" << std::endl;
+}
+
+int main() {
+    std::cout << "FINE-GRAINED TASK THROUGHPUT (" << TASKS << " tasks of " << TASK_WORK_ROUNDS << " xorshift rounds, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+    for (size_t workersCount = 1; workersCount <= MAX_WORKERS; workersCount *= 2) {
+        std::vector<uint64_t> results(TASKS);
+
+        {
+            LockedQueuePool pool(workersCount);
+            const double seconds = measureSeconds([&] {
+                for (size_t i = 0; i < TASKS; i++) {
+                    pool.submit([&results, i] {
+                        results[i] = taskWork(i + 1);
+                    });
+                }
+                pool.wait();
+            });
+            doNotOptimize(results.data());
+            printRow("mutex + condvar queue, submit/wait", workersCount, TASKS / seconds);
+        }
+
+        {
+            ThreadPool pool(workersCount);
+            double seconds = measureSeconds([&] {
+                pool.parallel_for(0, TASKS, [&results](size_t i) {
+                    results[i] = taskWork(i + 1);
+                });
+            });
+            doNotOptimize(results.data());
+            printRow("ThreadPool, parallel_for grain 1", workersCount, TASKS / seconds);
+
+            uint64_t fib = 0;
+            seconds = measureSeconds([&] {
+                fib = fibonacci(pool, FIBONACCI_N);
+            });
+            doNotOptimize(fib);
+            printRow("ThreadPool, fork/join fibonacci", workersCount, fibonacciTasks(FIBONACCI_N) / seconds);
+        }
+
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <fstream>
+#include <atomic>
+
+#include "ThreadPool.h"
+#include "../Dynamic_Array/Vector.h"
+
+// fork/join Fibonacci: every call above the cutoff spawns one half and runs the other itself
+uint64_t fibonacci(ThreadPool& pool, unsigned n) {
+    if (n < 2) {
+        return n;
+    }
+    if (n < 12) {
+        return fibonacci(pool, n - 1) + fibonacci(pool, n - 2);
+    }
+
+    uint64_t left = 0;
+    ThreadPool::TaskGroup group(pool);
+    group.spawn([&pool, &left, n] {
+        left = fibonacci(pool, n - 1);
+    });
+    const uint64_t right = fibonacci(pool, n - 2);
+    group.sync();
+
+    return left + right;
+}
+
+int main() {
+    std::ofstream myThreadPoolTestFile("ThreadPoolTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myThreadPoolTestFile << "THREAD POOL\n" << std::endl;
+
+    ThreadPool pool(4);
+    myThreadPoolTestFile << "ThreadPool(4), workers() = " << pool.workers() << std::endl;
+
+    // parallel_for over an index range
+    {
+        Vector<uint64_t> squares(100000, 0);
+        pool.parallel_for(0, squares.size(), [&squares](size_t i) {
+            squares[i] = uint64_t(i) * i;
+        }, 256);
+
+        uint64_t sum = 0;
+        for (uint64_t square : squares) {
+            sum += square;
+        }
+        myThreadPoolTestFile << "\nparallel_for() squaring 0 to 99999 in grains of 256, sum = " << sum
+                             << ", expected = " << uint64_t(99999) * 100000 * 199999 / 6 << std::endl;
+
+        std::atomic<size_t> calls{ 0 };
+        pool.parallel_for(7, 7, [&calls](size_t) {
+            calls++;
+        });
+        myThreadPoolTestFile << "parallel_for() over the empty range [7, 7) made " << calls.load() << " calls" << std::endl;
+    }
+
+    // spawn/sync from outside the pool
+    {
+        std::atomic<uint64_t> sum{ 0 };
+        ThreadPool::TaskGroup group(pool);
+        for (uint64_t i = 1; i <= 1000; i++) {
+            group.spawn([&sum, i] {
+                sum.fetch_add(i, std::memory_order_relaxed);
+            });
+        }
+        group.sync();
+
+        myThreadPoolTestFile << "\n1000 tasks spawned from the main thread, sum = " << sum.load() << std::endl;
+    }
+
+    // nested fork/join
+    {
+        myThreadPoolTestFile << "\nfork/join fibonacci(30) = " << fibonacci(pool, 30) << std::endl;
+    }
+
+    myThreadPoolTestFile.close();
+
+    return 0;
+}
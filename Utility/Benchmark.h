@@ -0,0 +1,27 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+
+// timing helpers shared by the benchmark.cpp programs
+
+// keeps the compiler from discarding a benchmarked result
+template<typename T>
+void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// returns the average nanoseconds per call of func over the given number of iterations
+template<typename Func>
+double measureNs(size_t iterations, Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        func();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+#endif // !BENCHMARK_H
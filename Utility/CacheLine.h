@@ -0,0 +1,13 @@
+#ifndef CACHELINE_H
+#define CACHELINE_H
+
+#include <cstddef>
+
+namespace constants {
+    // the unit of coherence between cores: data written by different threads should not share one of these.
+    // std::hardware_destructive_interference_size is avoided on purpose, its value may differ between
+    // translation units compiled with different -mtune flags
+    constexpr size_t CACHE_LINE_SIZE = 64;
+}
+
+#endif // !CACHELINE_H
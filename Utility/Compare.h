@@ -0,0 +1,98 @@
+#ifndef COMPARE_H
+#define COMPARE_H
+
+#include <cstddef>
+#include <cstring>
+#include <compare>
+#include <algorithm>
+#include <type_traits>
+
+// range comparisons shared by the contiguous containers (Vector, Array)
+
+namespace comparison {
+    // scalars whose equality is exactly equality of their object representation, so memcmp may stand in for operator==
+    template<typename _Type>
+    inline constexpr bool isBitwiseComparable = 
+        (std::is_integral_v<_Type> || std::is_enum_v<_Type> || std::is_pointer_v<_Type>) && 
+        std::has_unique_object_representations_v<_Type>;
+
+    // types for which memcmp also yields the lexicographic order
+    template<typename _Type>
+    inline constexpr bool isByteOrdered = 
+        std::is_same_v<_Type, unsigned char> || std::is_same_v<_Type, std::byte> || std::is_same_v<_Type, char8_t> ||
+        std::is_same_v<_Type, bool> || (std::is_same_v<_Type, char> && std::is_unsigned_v<char>);
+
+    // the number of bytes compared by one memcmp call while looking for the first mismatch
+    constexpr size_t _mismatchBlockBytes = 64;
+
+    // operator<=> when available, otherwise an ordering synthesized from operator<
+    template<typename _Type>
+    constexpr auto synthThreeWay(const _Type& left, const _Type& right) {
+        if constexpr (std::three_way_comparable<_Type>) {
+            return left <=> right;
+        } else {
+            if (left < right) {
+                return std::weak_ordering::less;
+            }
+
+            return right < left ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+        }
+    }
+
+    template<typename _Type>
+    using synthThreeWayResult = decltype(synthThreeWay(std::declval<const _Type&>(), std::declval<const _Type&>()));
+
+    template<typename _Type>
+    constexpr bool rangesEqual(const _Type* left, size_t leftSize, const _Type* right, size_t rightSize) {
+        if (leftSize != rightSize) {
+            return false;
+        }
+
+        if constexpr (isBitwiseComparable<_Type>) {
+            if (!std::is_constant_evaluated()) {
+                return leftSize == 0 || std::memcmp(left, right, leftSize * sizeof(_Type)) == 0;
+            }
+        }
+
+        return std::equal(left, left + leftSize, right);
+    }
+
+    template<typename _Type>
+    constexpr synthThreeWayResult<_Type> rangesCompare(const _Type* left, size_t leftSize, const _Type* right, size_t rightSize) {
+        const size_t common = std::min(leftSize, rightSize);
+
+        if constexpr (isByteOrdered<_Type>) {
+            if (!std::is_constant_evaluated()) {
+                const int result = common == 0 ? 0 : std::memcmp(left, right, common);
+                if (result != 0) {
+                    return result < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+                }
+
+                return leftSize <=> rightSize;
+            }
+        } else if constexpr (isBitwiseComparable<_Type>) {
+            if (!std::is_constant_evaluated()) {
+                // skip the equal prefix a block at a time, then locate the differing element inside the block
+                constexpr size_t blockCount = std::max<size_t>(1, _mismatchBlockBytes / sizeof(_Type));
+
+                size_t idx = 0;
+                while (idx + blockCount <= common && std::memcmp(left + idx, right + idx, blockCount * sizeof(_Type)) == 0) {
+                    idx += blockCount;
+                }
+
+                for (; idx < common; idx++) {
+                    if (left[idx] != right[idx]) {
+                        return left[idx] <=> right[idx];
+                    }
+                }
+
+                return leftSize <=> rightSize;
+            }
+        }
+
+        return std::lexicographical_compare_three_way(left, left + leftSize, right, right + rightSize, 
+        [](const _Type& l, const _Type& r) { return synthThreeWay(l, r); });
+    }
+}
+
+#endif // !COMPARE_H
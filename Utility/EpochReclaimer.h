@@ -0,0 +1,242 @@
+#ifndef EPOCHRECLAIMER_H
+#define EPOCHRECLAIMER_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "CacheLine.h"
+#include "../Dynamic_Array/Vector.h"
+
+// epoch-based reclamation of nodes unlinked from lock-free containers
+//
+// A thread pins the current global epoch before it reads shared nodes and unpins it afterwards. A node
+// unlinked while the global epoch is e may still be read by threads pinned at e or e + 1, but not by any
+// thread once the epoch has reached e + 2, and the epoch only advances when every pinned thread has
+// caught up with it. Retired nodes are therefore kept in three per-thread bags indexed by epoch % 3 and a
+// bag is freed when its thread observes an epoch three ahead of the one it was filled in.
+// The reclaimer is a process-wide singleton; threads register lazily and hand their record (and any
+// nodes still waiting in it) on to later threads when they exit.
+
+namespace constants {
+    // retires between two attempts to advance the global epoch
+    constexpr size_t EPOCH_ADVANCE_INTERVAL = 64;
+}
+
+class EpochReclaimer {
+private:
+    struct _Record;
+
+public:
+    // keeps the calling thread pinned while alive; guards nest
+    class Guard {
+    public:
+        explicit Guard(EpochReclaimer& reclaimer);
+
+        Guard(const Guard& source) = delete;
+
+        Guard& operator=(const Guard& right) = delete;
+
+        ~Guard();
+
+    private:
+        EpochReclaimer& _reclaimer;
+        _Record& _record;
+    };
+
+    static EpochReclaimer& instance();
+
+    // dtor frees every node still waiting, at which point no thread may use the reclaimer any more
+    ~EpochReclaimer();
+
+    Guard pin();
+
+    // deletes object once no thread can be reading it any more
+    template<typename _Type>
+    void retire(_Type* object);
+
+    void retire(void* object, void (*deleter)(void*));
+
+    uint64_t epoch() const;
+
+private:
+    struct _RetiredObject {
+        void* _object;
+        void (*_deleter)(void*);
+    };
+
+    struct alignas(constants::CACHE_LINE_SIZE) _Record {
+        std::atomic<uint64_t> _state{ 0 }; // (pinned epoch << 1) | pinned
+        std::atomic<bool> _owned{ false };
+        _Record* _next = nullptr;
+
+        // touched only by the owning thread
+        size_t _pinDepth = 0;
+        uint64_t _localEpoch = 0;
+        size_t _retiredSinceAdvance = 0;
+        Vector<_RetiredObject> _limbo[3];
+    };
+
+    // releases the record of an exiting thread
+    struct _RecordHandle {
+        ~_RecordHandle();
+
+        _Record* _record = nullptr;
+    };
+
+    EpochReclaimer() = default;
+
+    _Record& _localRecord();
+
+    _Record* _acquireRecord();
+
+    void _enter(_Record& record);
+
+    void _leave(_Record& record);
+
+    bool _tryAdvance();
+
+    static void _freeAll(Vector<_RetiredObject>& bag);
+
+private:
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<uint64_t> _globalEpoch{ 0 };
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<_Record*> _records{ nullptr }; // every record ever registered
+};
+
+// EpochReclaimer definition
+
+inline EpochReclaimer::Guard::Guard(EpochReclaimer& reclaimer) : _reclaimer(reclaimer), _record(reclaimer._localRecord()) {
+    _reclaimer._enter(_record);
+}
+
+inline EpochReclaimer::Guard::~Guard() {
+    _reclaimer._leave(_record);
+}
+
+inline EpochReclaimer::_RecordHandle::~_RecordHandle() {
+    if (_record != nullptr) {
+        _record->_owned.store(false, std::memory_order_release);
+    }
+}
+
+inline EpochReclaimer& EpochReclaimer::instance() {
+    static EpochReclaimer reclaimer;
+    return reclaimer;
+}
+
+inline EpochReclaimer::~EpochReclaimer() {
+    _Record* record = _records.load(std::memory_order_acquire);
+    while (record != nullptr) {
+        _Record* next = record->_next;
+        for (Vector<_RetiredObject>& bag : record->_limbo) {
+            _freeAll(bag);
+        }
+        delete record;
+        record = next;
+    }
+}
+
+inline EpochReclaimer::Guard EpochReclaimer::pin() {
+    return Guard(*this);
+}
+
+template<typename _Type>
+void EpochReclaimer::retire(_Type* object) {
+    retire(object, [](void* erased) {
+        delete static_cast<_Type*>(erased);
+    });
+}
+
+inline void EpochReclaimer::retire(void* object, void (*deleter)(void*)) {
+    // pinned, so the epoch the object goes in is not older than the one it was unlinked in
+    Guard guard(*this);
+    _Record& record = _localRecord();
+
+    record._limbo[record._localEpoch % 3].push_back({ object, deleter });
+
+    if (++record._retiredSinceAdvance >= constants::EPOCH_ADVANCE_INTERVAL) {
+        record._retiredSinceAdvance = 0;
+        _tryAdvance();
+    }
+}
+
+inline uint64_t EpochReclaimer::epoch() const {
+    return _globalEpoch.load(std::memory_order_relaxed);
+}
+
+inline EpochReclaimer::_Record& EpochReclaimer::_localRecord() {
+    thread_local _RecordHandle handle;
+
+    if (handle._record == nullptr) {
+        handle._record = _acquireRecord();
+    }
+
+    return *handle._record;
+}
+
+inline EpochReclaimer::_Record* EpochReclaimer::_acquireRecord() {
+    // reuse the record of a thread that has exited
+    for (_Record* record = _records.load(std::memory_order_acquire); record != nullptr; record = record->_next) {
+        bool owned = false;
+        if (!record->_owned.load(std::memory_order_relaxed) &&
+            record->_owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+            return record;
+        }
+    }
+
+    _Record* record = new _Record();
+    record->_owned.store(true, std::memory_order_relaxed);
+
+    _Record* head = _records.load(std::memory_order_relaxed);
+    do {
+        record->_next = head;
+    } while (!_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    return record;
+}
+
+inline void EpochReclaimer::_enter(_Record& record) {
+    if (record._pinDepth++ > 0) {
+        return;
+    }
+
+    // acquire pairs with the advancing CAS, which saw every earlier reader unpin
+    const uint64_t global = _globalEpoch.load(std::memory_order_acquire);
+
+    // seq_cst exchange: the pin must be visible to _tryAdvance before any shared node is read
+    record._state.exchange((global << 1) | 1, std::memory_order_seq_cst);
+
+    if (record._localEpoch != global) {
+        // the bag of this epoch's residue class holds nodes retired three or more epochs ago
+        record._localEpoch = global;
+        _freeAll(record._limbo[global % 3]);
+    }
+}
+
+inline void EpochReclaimer::_leave(_Record& record) {
+    if (--record._pinDepth == 0) {
+        record._state.store(record._localEpoch << 1, std::memory_order_release);
+    }
+}
+
+inline bool EpochReclaimer::_tryAdvance() {
+    uint64_t global = _globalEpoch.load(std::memory_order_seq_cst);
+
+    for (_Record* record = _records.load(std::memory_order_acquire); record != nullptr; record = record->_next) {
+        const uint64_t state = record->_state.load(std::memory_order_seq_cst);
+        if ((state & 1) != 0 && (state >> 1) != global) {
+            // a thread is still pinned at an older epoch
+            return false;
+        }
+    }
+
+    return _globalEpoch.compare_exchange_strong(global, global + 1, std::memory_order_seq_cst);
+}
+
+inline void EpochReclaimer::_freeAll(Vector<_RetiredObject>& bag) {
+    for (const _RetiredObject& retired : bag) {
+        retired._deleter(retired._object);
+    }
+    bag.clear();
+}
+
+#endif // !EPOCHRECLAIMER_H
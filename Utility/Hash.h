@@ -0,0 +1,121 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "Compare.h"
+
+// byte-oriented hashing shared by the contiguous containers (Vector, Array)
+//
+// The mixing follows the wyhash construction: 64x64->128 bit multiplies folded back to 64 bits,
+// three independent lanes consuming 48 bytes per round for long inputs. It is not cryptographic,
+// but it passes SMHasher and keeps up with memory bandwidth on 64-bit targets.
+
+namespace hashing {
+    constexpr uint64_t _secret0 = 0xa0761d6478bd642full;
+    constexpr uint64_t _secret1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t _secret2 = 0x8ebc6af09c88c6e3ull;
+    constexpr uint64_t _secret3 = 0x589965cc75374cc3ull;
+
+    inline void _multiply(uint64_t& lo, uint64_t& hi) {
+        const __uint128_t product = static_cast<__uint128_t>(lo) * hi;
+        lo = static_cast<uint64_t>(product);
+        hi = static_cast<uint64_t>(product >> 64);
+    }
+
+    inline uint64_t _mix(uint64_t a, uint64_t b) {
+        _multiply(a, b);
+        return a ^ b;
+    }
+
+    inline uint64_t _read8(const uint8_t* ptr) {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t _read4(const uint8_t* ptr) {
+        uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    // reads 1 to 3 bytes without branching on the exact length
+    inline uint64_t _read3(const uint8_t* ptr, size_t len) {
+        return (static_cast<uint64_t>(ptr[0]) << 16) | (static_cast<uint64_t>(ptr[len >> 1]) << 8) | ptr[len - 1];
+    }
+
+    inline uint64_t hashBytes(const void* key, size_t len, uint64_t seed = 0) {
+        const uint8_t* ptr = static_cast<const uint8_t*>(key);
+        uint64_t a, b;
+
+        seed ^= _mix(seed ^ _secret0, _secret1);
+
+        if (len <= 16) {
+            if (len >= 4) {
+                const size_t shift = (len >> 3) << 2;
+                a = (_read4(ptr) << 32) | _read4(ptr + shift);
+                b = (_read4(ptr + len - 4) << 32) | _read4(ptr + len - 4 - shift);
+            } else if (len > 0) {
+                a = _read3(ptr, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t remaining = len;
+
+            if (remaining > 48) {
+                uint64_t lane1 = seed, lane2 = seed;
+                do {
+                    seed = _mix(_read8(ptr) ^ _secret1, _read8(ptr + 8) ^ seed);
+                    lane1 = _mix(_read8(ptr + 16) ^ _secret2, _read8(ptr + 24) ^ lane1);
+                    lane2 = _mix(_read8(ptr + 32) ^ _secret3, _read8(ptr + 40) ^ lane2);
+                    ptr += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= lane1 ^ lane2;
+            }
+
+            while (remaining > 16) {
+                seed = _mix(_read8(ptr) ^ _secret1, _read8(ptr + 8) ^ seed);
+                ptr += 16;
+                remaining -= 16;
+            }
+
+            // the tail always reads the last 16 bytes, overlapping already consumed input if needed
+            a = _read8(ptr + remaining - 16);
+            b = _read8(ptr + remaining - 8);
+        }
+
+        a ^= _secret1;
+        b ^= seed;
+        _multiply(a, b);
+
+        return _mix(a ^ _secret0 ^ len, b ^ _secret1);
+    }
+
+    // folds the hash of a single element into a running hash
+    inline uint64_t combine(uint64_t seed, uint64_t value) {
+        return _mix(seed ^ _secret0, value ^ _secret2);
+    }
+
+    // hashes a contiguous range: bytewise when equality is bitwise, element by element through std::hash otherwise
+    template<typename _Type>
+    uint64_t hashRange(const _Type* first, size_t count) {
+        if constexpr (comparison::isBitwiseComparable<_Type>) {
+            return hashBytes(first, count * sizeof(_Type));
+        } else {
+            uint64_t seed = _mix(count ^ _secret0, _secret1);
+            for (size_t i = 0; i < count; i++) {
+                seed = combine(seed, std::hash<_Type>{}(first[i]));
+            }
+
+            return seed;
+        }
+    }
+}
+
+#endif // !HASH_H
@@ -0,0 +1,79 @@
+#ifndef PARKINGLOT_H
+#define PARKINGLOT_H
+
+#include <atomic>
+#include <cstdint>
+
+// threads sleeping on an atomic wait (a futex on Linux) until another thread changes what they wait for
+//
+// A parked thread counts itself as a sleeper, issues a seq_cst fence and rechecks its condition before it
+// sleeps on the signal word; a notifier publishes its change, issues a seq_cst fence and only bumps and
+// notifies the signal word when it sees a sleeper. Of the two fences one comes first, so either the
+// notifier sees the sleeper or the recheck sees the change, and a wake-up is never lost. Notifying while
+// nobody is parked costs a fence and a load. The caller spins before parking as suits it.
+
+class ParkingLot {
+public:
+    ParkingLot();
+
+    ParkingLot(const ParkingLot& source) = delete;
+
+    ParkingLot& operator=(const ParkingLot& right) = delete;
+
+    // sleeps until a notify, unless ready() is true once the thread counts as a sleeper
+    template<typename Ready>
+    void park(Ready&& ready);
+
+    // wake parked threads if there are any; call them after the change that makes ready() true
+    void notify_one();
+
+    void notify_all();
+
+private:
+    // the fence and the sleeper check of notify_one() and notify_all(), true if somebody is parked
+    bool _hasSleepers() const;
+
+private:
+    std::atomic<uint32_t> _signal; // bumped to release parked threads
+    std::atomic<uint32_t> _sleepers;
+};
+
+// ParkingLot definition
+
+inline ParkingLot::ParkingLot() : _signal(0), _sleepers(0) {}
+
+template<typename Ready>
+void ParkingLot::park(Ready&& ready) {
+    const uint32_t ticket = _signal.load(std::memory_order_acquire);
+    _sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+    // pairs with the fence in _hasSleepers: either the notifier sees this sleeper or this recheck sees its change
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!ready()) {
+        _signal.wait(ticket, std::memory_order_acquire);
+    }
+
+    _sleepers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void ParkingLot::notify_one() {
+    if (_hasSleepers()) {
+        _signal.fetch_add(1, std::memory_order_release);
+        _signal.notify_one();
+    }
+}
+
+inline void ParkingLot::notify_all() {
+    if (_hasSleepers()) {
+        _signal.fetch_add(1, std::memory_order_release);
+        _signal.notify_all();
+    }
+}
+
+inline bool ParkingLot::_hasSleepers() const {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return _sleepers.load(std::memory_order_relaxed) > 0;
+}
+
+#endif // !PARKINGLOT_H
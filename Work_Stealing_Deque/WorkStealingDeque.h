@@ -0,0 +1,207 @@
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <bit>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "../Utility/CacheLine.h"
+#include "../Dynamic_Array/Vector.h"
+
+namespace constants {
+    constexpr size_t DEFAULT_WORK_STEALING_CAPACITY = 256;
+}
+
+// interface of a Chase-Lev work-stealing deque, with the memory orderings of Le, Pop, Cohen and
+// Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+// One owner thread pushes and pops at the bottom and only synchronizes with thieves when a single
+// element is left; any number of thieves take elements from the top by CAS on _top. Like the ring
+// Deque, elements live in a power-of-two circular buffer indexed with a mask. The owner doubles the
+// buffer when it is full; a thief may still be reading the old one, so old buffers are kept until the
+// deque is destroyed (together they are never larger than the current buffer).
+// Slots are relaxed atomics, which keeps the benign races between the owner and thieves well defined,
+// so _Type has to be trivially copyable and lock-free as an atomic (task pointers, indices).
+
+template<typename _Type>
+class WorkStealingDeque {
+public:
+    using value_type = _Type;
+    using size_type = size_t;
+
+public:
+    static_assert(std::is_trivially_copyable_v<_Type>, "WorkStealingDeque Error: Element type must be trivially copyable!");
+    static_assert(std::atomic<_Type>::is_always_lock_free, "WorkStealingDeque Error: Element type must be lock-free as an atomic!");
+
+    // ctors
+    explicit WorkStealingDeque(size_t capacity = constants::DEFAULT_WORK_STEALING_CAPACITY);
+
+    WorkStealingDeque(const WorkStealingDeque& source) = delete;
+
+    // dtor, must not run concurrently with any other member
+    ~WorkStealingDeque();
+
+    // operator=
+    WorkStealingDeque& operator=(const WorkStealingDeque& right) = delete;
+
+    // capacity, exact only while no other thread operates on the deque
+    bool empty() const;
+
+    size_t size() const;
+
+    size_t capacity() const;
+
+    // modifiers of the owner thread
+    void push(const _Type& value);
+
+    // takes the most recently pushed element; false if the deque was empty
+    bool try_pop(_Type& value);
+
+    // modifiers of any thread
+    // takes the oldest element; false if the deque was empty or another thread took that element first
+    bool try_steal(_Type& value);
+
+private:
+    struct _Buffer {
+        explicit _Buffer(size_t capacity) : _mask(capacity - 1), _slots(new std::atomic<_Type>[capacity]) {}
+
+        ~_Buffer() {
+            delete[] _slots;
+        }
+
+        size_t capacity() const {
+            return _mask + 1;
+        }
+
+        _Type load(int64_t pos) const {
+            return _slots[static_cast<size_t>(pos) & _mask].load(std::memory_order_relaxed);
+        }
+
+        void store(int64_t pos, const _Type& value) {
+            _slots[static_cast<size_t>(pos) & _mask].store(value, std::memory_order_relaxed);
+        }
+
+        size_t _mask;
+        std::atomic<_Type>* _slots;
+    };
+
+    _Buffer* _grow(_Buffer* buffer, int64_t top, int64_t bottom);
+
+private:
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<int64_t> _top; // next element to steal, advanced by CAS
+    alignas(constants::CACHE_LINE_SIZE) std::atomic<int64_t> _bottom; // next free slot, written by the owner only
+    std::atomic<_Buffer*> _buffer;
+    Vector<_Buffer*> _oldBuffers; // buffers replaced by _grow, thieves may still read them
+};
+
+// WorkStealingDeque definition
+
+template<typename _Type>
+WorkStealingDeque<_Type>::WorkStealingDeque(size_t capacity) :
+    _top(0), _bottom(0), _buffer(new _Buffer(std::bit_ceil(std::max<size_t>(capacity, 2)))), _oldBuffers() {}
+
+template<typename _Type>
+WorkStealingDeque<_Type>::~WorkStealingDeque() {
+    delete _buffer.load(std::memory_order_relaxed);
+    for (_Buffer* buffer : _oldBuffers) {
+        delete buffer;
+    }
+}
+
+template<typename _Type>
+bool WorkStealingDeque<_Type>::empty() const {
+    return size() == 0;
+}
+
+template<typename _Type>
+size_t WorkStealingDeque<_Type>::size() const {
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    const int64_t top = _top.load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+template<typename _Type>
+size_t WorkStealingDeque<_Type>::capacity() const {
+    return _buffer.load(std::memory_order_relaxed)->capacity();
+}
+
+template<typename _Type>
+void WorkStealingDeque<_Type>::push(const _Type& value) {
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    const int64_t top = _top.load(std::memory_order_acquire);
+    _Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > static_cast<int64_t>(buffer->capacity()) - 1) {
+        buffer = _grow(buffer, top, bottom);
+    }
+
+    buffer->store(bottom, value);
+
+    // release: the element must be visible before a thief can see the new bottom (a release store
+    // instead of the paper's release fence and relaxed store, equivalent here and visible to TSan)
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename _Type>
+bool WorkStealingDeque<_Type>::try_pop(_Type& value) {
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+
+    // orders the claim on the bottom element before reading _top, pairs with the fence in try_steal
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // was empty
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    value = buffer->load(bottom);
+    if (top == bottom) {
+        // last element: race the thieves for it through _top
+        const bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    return true;
+}
+
+template<typename _Type>
+bool WorkStealingDeque<_Type>::try_steal(_Type& value) {
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) {
+        return false;
+    }
+
+    // the element is read before the CAS; if the CAS fails it may belong to someone else and is dropped
+    const _Type candidate = _buffer.load(std::memory_order_acquire)->load(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    value = candidate;
+    return true;
+}
+
+template<typename _Type>
+typename WorkStealingDeque<_Type>::_Buffer* WorkStealingDeque<_Type>::_grow(_Buffer* buffer, int64_t top, int64_t bottom) {
+    _Buffer* grown = new _Buffer(2 * buffer->capacity());
+    for (int64_t pos = top; pos < bottom; pos++) {
+        grown->store(pos, buffer->load(pos));
+    }
+
+    _oldBuffers.push_back(buffer);
+    _buffer.store(grown, std::memory_order_release);
+
+    return grown;
+}
+
+#endif // !WORKSTEALINGDEQUE_H
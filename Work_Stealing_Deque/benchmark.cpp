@@ -0,0 +1,196 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+#include "WorkStealingDeque.h"
+#include "../Double_Ended_Queue_GNU_Version/Deque.h"
+
+constexpr size_t MAX_THIEVES = 16;
+constexpr uint64_t TOTAL_ELEMENTS = 1 << 22;
+constexpr uint64_t OWNER_BURST = 64; // elements the owner pushes before popping some back
+
+// baseline: the GNU Deque behind one mutex, the owner works at the back and thieves at the front
+class LockedDeque {
+public:
+    void push(uint64_t value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _deque.push_back(value);
+    }
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.empty()) {
+            return false;
+        }
+        value = _deque.back();
+        _deque.pop_back();
+
+        return true;
+    }
+
+    bool try_steal(uint64_t& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_deque.empty()) {
+            return false;
+        }
+        value = _deque.front();
+        _deque.pop_front();
+
+        return true;
+    }
+
+    bool empty() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _deque.empty();
+    }
+
+private:
+    std::mutex _mutex;
+    Deque<uint64_t> _deque;
+};
+
+struct Result {
+    double mopsPerSecond; // elements taken per microsecond
+    double stolenShare;
+    double failedStealShare; // failed try_steal calls over all try_steal calls
+    bool checksumOk;
+};
+
+// the owner pushes TOTAL_ELEMENTS in bursts and pops half of every burst back, thieves steal until
+// everything is taken
+template<typename _Deque>
+Result runOwnerAndThieves(size_t thievesCount) {
+    _Deque deque;
+    std::atomic<bool> go{ false };
+    std::atomic<bool> done{ false };
+    std::atomic<uint64_t> takenSum{ 0 };
+    std::atomic<uint64_t> stolen{ 0 };
+    std::atomic<uint64_t> failedSteals{ 0 };
+    std::vector<std::thread> thieves;
+
+    for (size_t t = 0; t < thievesCount; t++) {
+        thieves.emplace_back([&] {
+            uint64_t value = 0, sum = 0, count = 0, failed = 0;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (deque.try_steal(value)) {
+                    sum += value;
+                    count++;
+                } else {
+                    failed++;
+                }
+            }
+            takenSum.fetch_add(sum);
+            stolen.fetch_add(count);
+            failedSteals.fetch_add(failed);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+
+    uint64_t value = 0, sum = 0;
+    for (uint64_t next = 1; next <= TOTAL_ELEMENTS;) {
+        for (uint64_t i = 0; i < OWNER_BURST && next <= TOTAL_ELEMENTS; i++) {
+            deque.push(next++);
+        }
+        for (uint64_t i = 0; i < OWNER_BURST / 2 && deque.try_pop(value); i++) {
+            sum += value;
+        }
+    }
+    while (deque.try_pop(value)) {
+        sum += value;
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    takenSum.fetch_add(sum);
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    const uint64_t attempts = stolen.load() + failedSteals.load();
+
+    return { TOTAL_ELEMENTS / ns * 1e3, double(stolen.load()) / TOTAL_ELEMENTS,
+             attempts == 0 ? 0.0 : double(failedSteals.load()) / attempts,
+             takenSum.load() == TOTAL_ELEMENTS * (TOTAL_ELEMENTS + 1) / 2 };
+}
+
+// the deque is filled up front and drained by thieves only, every take contends on the top
+template<typename _Deque>
+Result runThievesOnly(size_t thievesCount) {
+    _Deque deque;
+    for (uint64_t i = 1; i <= TOTAL_ELEMENTS; i++) {
+        deque.push(i);
+    }
+
+    std::atomic<bool> go{ false };
+    std::atomic<uint64_t> takenSum{ 0 };
+    std::atomic<uint64_t> failedSteals{ 0 };
+    std::vector<std::thread> thieves;
+
+    for (size_t t = 0; t < thievesCount; t++) {
+        thieves.emplace_back([&] {
+            uint64_t value = 0, sum = 0, failed = 0;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!deque.empty()) {
+                if (deque.try_steal(value)) {
+                    sum += value;
+                } else {
+                    failed++;
+                }
+            }
+            takenSum.fetch_add(sum);
+            failedSteals.fetch_add(failed);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    return { TOTAL_ELEMENTS / ns * 1e3, 1.0, double(failedSteals.load()) / (TOTAL_ELEMENTS + failedSteals.load()),
+             takenSum.load() == TOTAL_ELEMENTS * (TOTAL_ELEMENTS + 1) / 2 };
+}
+
+void printRow(const char* name, size_t thievesCount, const Result& result) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(4) << thievesCount << " thieves"
+              << std::fixed << std::setprecision(1)
+              << std::setw(10) << result.mopsPerSecond << " Mops/s"
+              << std::setw(8) << result.stolenShare * 100 << "% stolen"
+              << std::setw(8) << result.failedStealShare * 100 << "% failed steals"
+              << (result.checksumOk ? "" : "   CHECKSUM MISMATCH") << std::endl;
+}
+
+int main() {
+    std::cout << "OWNER PUSHES/POPS, THIEVES STEAL (" << TOTAL_ELEMENTS << " elements, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+    for (size_t thievesCount = 0; thievesCount <= MAX_THIEVES; thievesCount = thievesCount == 0 ? 1 : thievesCount * 2) {
+        printRow("mutex + Deque", thievesCount, runOwnerAndThieves<LockedDeque>(thievesCount));
+        printRow("WorkStealingDeque", thievesCount, runOwnerAndThieves<WorkStealingDeque<uint64_t>>(thievesCount));
+        std::cout << std::endl;
+    }
+
+    std::cout << "THIEVES ONLY, DRAINING A FULL DEQUE\n" << std::endl;
+
+    for (size_t thievesCount = 1; thievesCount <= MAX_THIEVES; thievesCount *= 2) {
+        printRow("mutex + Deque", thievesCount, runThievesOnly<LockedDeque>(thievesCount));
+        printRow("WorkStealingDeque", thievesCount, runThievesOnly<WorkStealingDeque<uint64_t>>(thievesCount));
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
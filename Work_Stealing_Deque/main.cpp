@@ -0,0 +1,100 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "WorkStealingDeque.h"
+
+int main() {
+    std::ofstream myWorkStealingDequeTestFile("WorkStealingDequeTests.txt", std::ofstream::out | std::ios::trunc);
+
+    myWorkStealingDequeTestFile << "WORK-STEALING DEQUE\n" << std::endl;
+
+    // single-threaded use: the owner pops LIFO, thieves steal FIFO
+    {
+        WorkStealingDeque<int> deque(4);
+
+        myWorkStealingDequeTestFile << "WorkStealingDeque<int>(4), capacity() = " << deque.capacity()
+                                    << ", empty() = " << std::boolalpha << deque.empty() << std::endl;
+
+        for (int i = 1; i <= 10; i++) {
+            deque.push(i);
+        }
+        myWorkStealingDequeTestFile << "After push() of 1 to 10, size() = " << deque.size()
+                                    << ", capacity() = " << deque.capacity() << std::endl;
+
+        int value = 0;
+        myWorkStealingDequeTestFile << "try_steal() x3:";
+        for (int i = 0; i < 3; i++) {
+            if (deque.try_steal(value)) {
+                myWorkStealingDequeTestFile << " " << value;
+            }
+        }
+        myWorkStealingDequeTestFile << std::endl;
+
+        myWorkStealingDequeTestFile << "try_pop() until empty:";
+        while (deque.try_pop(value)) {
+            myWorkStealingDequeTestFile << " " << value;
+        }
+        myWorkStealingDequeTestFile << std::endl;
+
+        myWorkStealingDequeTestFile << "try_pop() = " << deque.try_pop(value)
+                                    << ", try_steal() = " << deque.try_steal(value) << " on the empty deque" << std::endl;
+    }
+
+    // the owner pushes and pops while thieves steal, every element must be taken exactly once
+    {
+        const unsigned thievesCount = 4;
+        const uint64_t pushesCount = 1000000;
+
+        WorkStealingDeque<uint64_t> deque(16);
+        std::atomic<bool> done{ false };
+        std::atomic<uint64_t> takenSum{ 0 };
+        std::atomic<uint64_t> takenCount{ 0 };
+        std::vector<std::thread> thieves;
+
+        for (unsigned t = 0; t < thievesCount; t++) {
+            thieves.emplace_back([&] {
+                uint64_t value = 0, sum = 0, count = 0;
+                while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                    if (deque.try_steal(value)) {
+                        sum += value;
+                        count++;
+                    }
+                }
+                takenSum.fetch_add(sum);
+                takenCount.fetch_add(count);
+            });
+        }
+
+        uint64_t value = 0, sum = 0, count = 0;
+        for (uint64_t i = 1; i <= pushesCount; i++) {
+            deque.push(i);
+            // pop every third element back, as a worker running its newest task would
+            if (i % 3 == 0 && deque.try_pop(value)) {
+                sum += value;
+                count++;
+            }
+        }
+        while (deque.try_pop(value)) {
+            sum += value;
+            count++;
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& thief : thieves) {
+            thief.join();
+        }
+        takenSum.fetch_add(sum);
+        takenCount.fetch_add(count);
+
+        myWorkStealingDequeTestFile << "\nOwner pushes 1 to 1000000 and pops every third, 4 thieves steal" << std::endl;
+        myWorkStealingDequeTestFile << "taken " << takenCount.load() << " elements, sum = " << takenSum.load()
+                                    << ", expected sum = " << pushesCount * (pushesCount + 1) / 2 << std::endl;
+        myWorkStealingDequeTestFile << "empty() = " << deque.empty() << std::endl;
+    }
+
+    myWorkStealingDequeTestFile.close();
+
+    return 0;
+}